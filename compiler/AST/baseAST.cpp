@@ -48,6 +48,8 @@
 #include <sstream>
 #include <string>
 
+#include <sys/resource.h>
+
 //
 // declare global vectors gSymExprs, gCallExprs, gFnSymbols, ...
 //
@@ -78,6 +80,128 @@ def_vec_hash(BaseAST);
 
 #undef def_vec_hash
 
+//
+// AST node allocation
+//
+// AST nodes are carved out of large slabs, segregated by size class,
+// rather than being malloc'ed one at a time.  Nodes deleted by
+// cleanAst() are threaded onto the free list for their size class and
+// reused by later passes.  This avoids the per-node malloc overhead,
+// keeps nodes allocated together close together in memory, and makes
+// the allocate/delete churn between passes cheap.  Slabs are never
+// returned to the system; nodes larger than kAstMaxPooledSize simply
+// use malloc.
+//
+static const size_t kAstAlign          = 16;
+static const size_t kAstMaxPooledSize  = 1024;
+static const size_t kAstNumSizeClasses = kAstMaxPooledSize / kAstAlign;
+static const size_t kAstSlabSize       = 256 * 1024;
+
+struct AstFreeNode {
+  AstFreeNode* next;
+};
+
+static AstFreeNode* astFreeLists[kAstNumSizeClasses];
+static char*        astSlabCur        = NULL;
+static char*        astSlabEnd        = NULL;
+static size_t       astSlabBytes      = 0;
+static size_t       astLiveBytes      = 0;
+static size_t       astMaxLiveBytes   = 0;
+
+static inline size_t astSizeClass(size_t size) {
+  return (size + kAstAlign - 1) / kAstAlign - 1;
+}
+
+static inline size_t astClassSize(size_t sizeClass) {
+  return (sizeClass + 1) * kAstAlign;
+}
+
+static void astFreeToPool(void* ptr, size_t sizeClass) {
+  AstFreeNode* node = (AstFreeNode*) ptr;
+
+  node->next              = astFreeLists[sizeClass];
+  astFreeLists[sizeClass] = node;
+}
+
+static void astNewSlab() {
+  size_t remaining = astSlabEnd - astSlabCur;
+
+  // Don't waste the tail of the old slab: hand it to the matching free list
+  if (remaining >= kAstAlign)
+    astFreeToPool(astSlabCur, astSizeClass(remaining));
+
+  astSlabCur = (char*) malloc(kAstSlabSize);
+
+  if (astSlabCur == NULL)
+    INT_FATAL("out of memory allocating AST nodes");
+
+  astSlabEnd    = astSlabCur + kAstSlabSize;
+  astSlabBytes += kAstSlabSize;
+}
+
+void* BaseAST::operator new(size_t size) {
+  void* retval = NULL;
+
+  if (size > kAstMaxPooledSize) {
+    retval = malloc(size);
+
+    if (retval == NULL)
+      INT_FATAL("out of memory allocating AST nodes");
+
+  } else {
+    size_t sizeClass = astSizeClass(size);
+    size_t bytes     = astClassSize(sizeClass);
+
+    if (AstFreeNode* node = astFreeLists[sizeClass]) {
+      astFreeLists[sizeClass] = node->next;
+      retval                  = node;
+
+    } else {
+      if ((size_t) (astSlabEnd - astSlabCur) < bytes)
+        astNewSlab();
+
+      retval      = astSlabCur;
+      astSlabCur += bytes;
+    }
+
+    astLiveBytes += bytes;
+
+    if (astLiveBytes > astMaxLiveBytes)
+      astMaxLiveBytes = astLiveBytes;
+  }
+
+  return retval;
+}
+
+void BaseAST::operator delete(void* ptr, size_t size) {
+  if (ptr == NULL) {
+
+  } else if (size > kAstMaxPooledSize) {
+    free(ptr);
+
+  } else {
+    size_t sizeClass = astSizeClass(size);
+
+    astFreeToPool(ptr, sizeClass);
+
+    astLiveBytes -= astClassSize(sizeClass);
+  }
+}
+
+static long peakRSSKiB() {
+  struct rusage usage;
+
+  // ru_maxrss is reported in KiB on Linux and in bytes on Darwin
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return -1;
+
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
 //
 // Throughout printStatistics(), "n" indicates the number of nodes;
 // "k" indicates how many KiB memory they occupy: k = n * sizeof(node) / 1024.
@@ -90,6 +214,11 @@ void printStatistics(const char* pass) {
     if (strstr(fPrintStatistics, "m")) {
       fprintf(stderr, "Maximum # of ASTS: %d\n", maxN);
       fprintf(stderr, "Maximum Size (KB): %d\n", maxK);
+      fprintf(stderr, "Maximum Pooled AST Size (KB): %d\n",
+              (int) (astMaxLiveBytes / 1024));
+      fprintf(stderr, "AST Pool Size (KB): %d\n",
+              (int) (astSlabBytes / 1024));
+      fprintf(stderr, "Peak RSS (KB): %ld\n", peakRSSKiB());
     }
   }
 
@@ -183,6 +312,7 @@ void trace_remove(BaseAST* ast, char flag) {
 
 #define clean_gvec(type)                        \
   int i##type = 0;                              \
+  int n##type = g##type##s.n;                   \
   forv_Vec(type, ast, g##type##s) {             \
     if (isAlive(ast) || isRootModuleWithType(ast, type)) { \
       g##type##s.v[i##type++] = ast;            \
@@ -191,7 +321,24 @@ void trace_remove(BaseAST* ast, char flag) {
       delete ast; ast = 0;                      \
     }                                           \
   }                                             \
-  g##type##s.n = i##type
+  g##type##s.n = i##type;                       \
+  compact_gvec(g##type##s, n##type)
+
+//
+// A pass such as resolution can leave a global vector much larger than
+// the number of nodes that survive it.  When most of a vector was
+// deleted, reallocate its storage to fit the live nodes so that we don't
+// carry the dead capacity through the remaining passes.
+//
+template <typename T>
+static void compact_gvec(Vec<T*>& gvec, int prevN) {
+  if (prevN > 1024 && gvec.n < prevN / 4) {
+    Vec<T*> live;
+
+    live.move(gvec);
+    gvec.copy(live);
+  }
+}
 
 
 static void clean_modvec(Vec<ModuleSymbol*>& modvec) {
@@ -260,6 +260,8 @@ void checkPrimitives()
      case PRIM_CHPL_COMM_REMOTE_PREFETCH:
      case PRIM_CHPL_COMM_GET_STRD:      // Direct calls to the Chapel comm layer for strided comm
      case PRIM_CHPL_COMM_PUT_STRD:      //  may eventually add others (e.g.: non-blocking)
+     case PRIM_CHPL_COMM_GET_BUFFERED:
+     case PRIM_CHPL_COMM_GET_BUFFER_FREE:
      case PRIM_ARRAY_GET:
      case PRIM_ARRAY_GET_VALUE:
      case PRIM_ARRAY_SHIFT_BASE_POINTER:
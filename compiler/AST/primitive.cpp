@@ -756,6 +756,9 @@ initPrimitive() {
   // Direct calls to the Chapel comm layer for strided comm
   prim_def(PRIM_CHPL_COMM_GET_STRD, "chpl_comm_get_strd", returnInfoVoid, true, true);
   prim_def(PRIM_CHPL_COMM_PUT_STRD, "chpl_comm_put_strd", returnInfoVoid, true, true);
+  // Buffered reads of consecutive remote elements, see bulkRemoteReads.cpp
+  prim_def(PRIM_CHPL_COMM_GET_BUFFERED, "chpl_comm_get_buffered", returnInfoVal, true, true);
+  prim_def(PRIM_CHPL_COMM_GET_BUFFER_FREE, "chpl_comm_get_buffer_free", returnInfoVoid, true, true);
 
   prim_def(PRIM_ARRAY_SHIFT_BASE_POINTER, "shift_base_pointer", returnInfoVoid, true);
 
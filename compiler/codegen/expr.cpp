@@ -4566,6 +4566,38 @@ DEFINE_PRIM(PRIM_CHPL_COMM_REMOTE_PREFETCH) {
                 call->get(5));
 }
 
+DEFINE_PRIM(PRIM_CHPL_COMM_GET_BUFFERED) {
+    // args are:
+    //   wide ref to element, wide ref to last element, handle, line, file
+    // The runtime returns a pointer to a local copy of the element.
+    GenRet elem    = call->get(1);
+    GenRet last    = call->get(2);
+    Type*  valType = call->get(1)->getValType();
+
+    std::vector<GenRet> args;
+
+    args.push_back(codegenRnode(elem));
+    args.push_back(codegenCastToVoidStar(codegenRaddr(elem)));
+    args.push_back(codegenCastToVoidStar(codegenRaddr(last)));
+    args.push_back(codegenSizeof(valType));
+    args.push_back(genTypeStructureIndex(valType->symbol));
+    args.push_back(codegenAddrOf(call->get(3)));
+    args.push_back(call->get(4));
+    args.push_back(call->get(5));
+
+    GenRet ptr = codegenCallExpr("chpl_gen_comm_get_buffered", args);
+
+    ret = codegenDeref(codegenCast(getOrMakeRefTypeDuringCodegen(valType),
+                                   ptr));
+}
+DEFINE_PRIM(PRIM_CHPL_COMM_GET_BUFFER_FREE) {
+    // args are: handle, line, file
+    codegenCall("chpl_gen_comm_get_buffer_free",
+                codegenAddrOf(call->get(1)),
+                call->get(2),
+                call->get(3));
+}
+
 // Strided versions of get and put
 static void codegenPutGetStrd(CallExpr* call, GenRet &ret) {
     // args are: localvar, dststr addr, locale, remote addr, srcstr addr
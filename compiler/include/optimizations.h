@@ -69,6 +69,10 @@ void liveVariableAnalysis(FnSymbol* fn,
 
 void remoteValueForwarding();
 
+void bulkRemoteReads();
+
+void autoLocalAccess();
+
 void inferConstRefs();
 
 void computeNoAliasSets();
@@ -154,6 +154,8 @@
   PRIMITIVE_G(PRIM_CHPL_COMM_REMOTE_PREFETCH)
   PRIMITIVE_G(PRIM_CHPL_COMM_GET_STRD)
   PRIMITIVE_G(PRIM_CHPL_COMM_PUT_STRD)
+  PRIMITIVE_G(PRIM_CHPL_COMM_GET_BUFFERED)
+  PRIMITIVE_G(PRIM_CHPL_COMM_GET_BUFFER_FREE)
 
   PRIMITIVE_G(PRIM_ARRAY_GET)
   PRIMITIVE_G(PRIM_ARRAY_GET_VALUE)
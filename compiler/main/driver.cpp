@@ -126,6 +126,8 @@ bool fNoDeadCodeElimination = false;
 bool fNoScalarReplacement = false;
 bool fNoTupleCopyOpt = false;
 bool fNoRemoteValueForwarding = false;
+bool fNoBulkRemoteReads = false;
+bool fNoAutoLocalAccess = false;
 bool fNoInferConstRefs = false;
 bool fNoRemoteSerialization = false;
 bool fNoRemoveCopyCalls = false;
@@ -710,6 +712,8 @@ static void setFastFlag(const ArgumentDescription* desc, const char* unused) {
   fNoLiveAnalysis = false;
   fNoInferConstRefs = false;
   fNoRemoteValueForwarding = false;
+  fNoBulkRemoteReads = false;
+  fNoAutoLocalAccess = false;
   fNoRemoteSerialization = false;
   fNoRemoveCopyCalls = false;
   fNoScalarReplacement = false;
@@ -760,6 +764,8 @@ static void setBaselineFlag(const ArgumentDescription* desc, const char* unused)
   fNoVectorize = true;                // --no-vectorize
   fNoInferConstRefs = true;           // --no-infer-const-refs
   fNoRemoteValueForwarding = true;    // --no-remote-value-forwarding
+  fNoBulkRemoteReads = true;          // --no-bulk-remote-reads
+  fNoAutoLocalAccess = true;          // --no-auto-local-access
   fNoRemoteSerialization = true;      // --no-remote-serialization
   fNoRemoveCopyCalls = true;          // --no-remove-copy-calls
   fNoScalarReplacement = true;        // --no-scalar-replacement
@@ -886,7 +892,9 @@ static ArgumentDescription arg_desc[] = {
  {"local", ' ', NULL, "Target one [many] locale[s]", "N", &fLocal, "CHPL_LOCAL", setLocal},
 
  {"", ' ', NULL, "Optimization Control Options", NULL, NULL, NULL, NULL},
+ {"auto-local-access", ' ', NULL, "Enable [disable] using local access paths for arrays indexed by forall indices", "n", &fNoAutoLocalAccess, "CHPL_DISABLE_AUTO_LOCAL_ACCESS", NULL},
  {"baseline", ' ', NULL, "Disable all Chapel optimizations", "F", &fBaseline, "CHPL_BASELINE", setBaselineFlag},
+ {"bulk-remote-reads", ' ', NULL, "Enable [disable] bulk reads of remote array elements in loops", "n", &fNoBulkRemoteReads, "CHPL_DISABLE_BULK_REMOTE_READS", NULL},
  {"cache-remote", ' ', NULL, "[Don't] enable cache for remote data", "N", &fCacheRemote, "CHPL_CACHE_REMOTE", setCacheEnable},
  {"copy-propagation", ' ', NULL, "Enable [disable] copy propagation", "n", &fNoCopyPropagation, "CHPL_DISABLE_COPY_PROPAGATION", NULL},
  {"dead-code-elimination", ' ', NULL, "Enable [disable] dead code elimination", "n", &fNoDeadCodeElimination, "CHPL_DISABLE_DEAD_CODE_ELIMINATION", NULL},
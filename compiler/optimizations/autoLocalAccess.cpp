@@ -0,0 +1,299 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "astutil.h"
+#include "build.h"
+#include "driver.h"
+#include "expr.h"
+#include "ForallStmt.h"
+#include "optimizations.h"
+#include "stlUtil.h"
+#include "stmt.h"
+#include "symbol.h"
+
+#include <set>
+#include <vector>
+
+/*
+   Automatic local access for foralls over distributed domains.
+
+   In a forall such as
+
+     forall i in D do A[i] = B[i] + C[i];
+
+   every access goes through the distribution's general accessor, which
+   has to determine which locale owns 'i'.  If A, B and C are distributed
+   over D itself, the owner is always the locale running the iteration
+   and the accesses can use localAccess() instead.
+
+   This runs before normalization, on the forall as written, and turns it
+   into
+
+     if chpl__staticAutoLocalCheck(A, D) && ... {      // param
+       if chpl__dynamicAutoLocalCheck(A, D) && ... {
+         forall i in D do A.localAccess(i) = B.localAccess(i) + ...;
+       } else {
+         forall i in D do A[i] = B[i] + C[i];
+       }
+     } else {
+       forall i in D do A[i] = B[i] + C[i];
+     }
+
+   The static check is resolved from the types of the arrays and the
+   iterand and folds away the optimized loop when the distribution does
+   not support it.  The dynamic check verifies once per forall, before any
+   leader chunk is created, that each array is declared over the very
+   domain that is being iterated.
+
+   Only accesses whose sole argument is the forall's index variable and
+   whose base is a variable declared outside of the loop are considered.
+   Foralls containing 'on' statements are left alone since the body might
+   not run on the locale that owns the index.  Accesses within a nested
+   forall, coforall, begin or cobegin are not rewritten either, since a
+   nested forall over a distributed iterand runs its iterations on other
+   locales.
+ */
+
+static bool      isCandidateForall(ForallStmt* forall);
+static Expr*     iterandFor(ForallStmt* forall);
+static bool      containsOnStmt(BlockStmt* body);
+static bool      isInNestedParallel(CallExpr* call, ForallStmt* forall);
+static void      findLocalAccesses(ForallStmt*             forall,
+                                   std::vector<CallExpr*>& accesses,
+                                   std::vector<Symbol*>&   bases);
+static Expr*     buildChecks(const char*           checkName,
+                             std::vector<Symbol*>& bases,
+                             Expr*                 iterand);
+static void      optimizeForall(ForallStmt* forall);
+
+void autoLocalAccess() {
+  if (fNoAutoLocalAccess == true)
+    return;
+
+  std::vector<ForallStmt*> foralls;
+
+  // optimizeForall() adds copies to gForallStmts, so collect first.
+  forv_Vec(ForallStmt, forall, gForallStmts) {
+    if (forall->inTree() && isCandidateForall(forall))
+      foralls.push_back(forall);
+  }
+
+  for_vector(ForallStmt, forall, foralls) {
+    optimizeForall(forall);
+  }
+}
+
+static bool isCandidateForall(ForallStmt* forall) {
+  ModuleSymbol* mod = forall->getModule();
+
+  if (mod == NULL || mod->modTag != MOD_USER)
+    return false;
+
+  if (forall->zippered()            == true ||
+      forall->fromReduce()          == true ||
+      forall->createdFromForLoop()  == true ||
+      forall->numInductionVars()    != 1    ||
+      forall->numIteratedExprs()    != 1)
+    return false;
+
+  if (iterandFor(forall) == NULL)
+    return false;
+
+  return containsOnStmt(forall->loopBody()) == false;
+}
+
+//
+// The iterand has to be something that can be evaluated again without
+// side effects: a variable 'D' or 'X.domain'.
+//
+static Expr* iterandFor(ForallStmt* forall) {
+  Expr* iterExpr = forall->firstIteratedExpr();
+
+  if (SymExpr* se = toSymExpr(iterExpr)) {
+    if (isVarSymbol(se->symbol()) || isArgSymbol(se->symbol()))
+      return se;
+
+  } else if (CallExpr* call = toCallExpr(iterExpr)) {
+    const char* name = NULL;
+
+    if (call->isNamed(".")              == true &&
+        call->numActuals()              == 2    &&
+        isSymExpr(call->get(1))         == true &&
+        get_string(call->get(2), &name) == true &&
+        strcmp(name, "domain")          == 0)
+      return call;
+  }
+
+  return NULL;
+}
+
+static bool containsOnStmt(BlockStmt* body) {
+  std::vector<CallExpr*> calls;
+
+  collectCallExprs(body, calls);
+
+  for_vector(CallExpr, call, calls) {
+    if (call->isPrimitive(PRIM_BLOCK_ON)         ||
+        call->isPrimitive(PRIM_BLOCK_BEGIN_ON)   ||
+        call->isPrimitive(PRIM_BLOCK_COBEGIN_ON) ||
+        call->isPrimitive(PRIM_BLOCK_COFORALL_ON))
+      return true;
+  }
+
+  return false;
+}
+
+//
+// Is 'call' within a forall or task construct nested inside 'forall'?
+//
+static bool isInNestedParallel(CallExpr* call, ForallStmt* forall) {
+  for (Expr* cur = call->parentExpr; cur != forall; cur = cur->parentExpr) {
+    if (isForallStmt(cur) == true)
+      return true;
+
+    // Loop statements do not carry block info.
+    BlockStmt* block = toBlockStmt(cur);
+
+    if (block != NULL && block->isLoopStmt() == false) {
+      if (CallExpr* info = block->blockInfoGet()) {
+        if (info->isPrimitive(PRIM_BLOCK_BEGIN)   ||
+            info->isPrimitive(PRIM_BLOCK_COBEGIN) ||
+            info->isPrimitive(PRIM_BLOCK_COFORALL))
+          return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+//
+// Collect the calls 'A[i]' or 'A(i)' in the body of 'forall' where 'i' is
+// its index variable and 'A' is a variable defined outside of the loop.
+//
+static void findLocalAccesses(ForallStmt*             forall,
+                              std::vector<CallExpr*>& accesses,
+                              std::vector<Symbol*>&   bases) {
+  Symbol*                index = forall->firstInductionVarDef()->sym;
+  std::vector<CallExpr*> calls;
+  std::set<Symbol*>      seen;
+
+  collectCallExprs(forall->loopBody(), calls);
+
+  for_vector(CallExpr, call, calls) {
+    SymExpr* base = toSymExpr(call->baseExpr);
+
+    if (base == NULL || call->numActuals() != 1)
+      continue;
+
+    SymExpr* idx = toSymExpr(call->get(1));
+
+    if (idx == NULL || idx->symbol() != index)
+      continue;
+
+    Symbol* sym = base->symbol();
+
+    if (isVarSymbol(sym) == false && isArgSymbol(sym) == false)
+      continue;
+
+    if (sym->hasFlag(FLAG_TYPE_VARIABLE) == true ||
+        sym->hasFlag(FLAG_PARAM)         == true)
+      continue;
+
+    // Accesses within nested functions or nested parallel constructs
+    // could run anywhere.
+    if (call->parentSymbol != forall->parentSymbol ||
+        isInNestedParallel(call, forall) == true)
+      continue;
+
+    // Variables declared in the loop body change from one iteration to
+    // the next.
+    bool inLoop = false;
+
+    for (Expr* cur = sym->defPoint; cur != NULL; cur = cur->parentExpr) {
+      if (cur == forall) {
+        inLoop = true;
+        break;
+      }
+    }
+
+    if (inLoop == true)
+      continue;
+
+    accesses.push_back(call);
+
+    if (seen.insert(sym).second == true)
+      bases.push_back(sym);
+  }
+}
+
+static Expr* buildChecks(const char*           checkName,
+                         std::vector<Symbol*>& bases,
+                         Expr*                 iterand) {
+  Expr* retval = NULL;
+
+  for_vector(Symbol, base, bases) {
+    Expr* check = new CallExpr(checkName, base, iterand->copy());
+
+    retval = (retval == NULL) ? check : new CallExpr("&&", retval, check);
+  }
+
+  return retval;
+}
+
+static void optimizeForall(ForallStmt* forall) {
+  std::vector<CallExpr*> accesses;
+  std::vector<Symbol*>   bases;
+
+  findLocalAccesses(forall, accesses, bases);
+
+  if (accesses.size() == 0)
+    return;
+
+  SET_LINENO(forall);
+
+  Expr*       iterand   = iterandFor(forall);
+  ForallStmt* fast      = forall->copy();
+  ForallStmt* fallback  = forall->copy();
+  Expr*       staticChk = buildChecks("chpl__staticAutoLocalCheck",
+                                      bases, iterand);
+  Expr*       dynChk    = buildChecks("chpl__dynamicAutoLocalCheck",
+                                      bases, iterand);
+  BlockStmt*  anchor    = new BlockStmt();
+
+  forall->insertBefore(anchor);
+  forall->remove();
+
+  anchor->replace(buildIfStmt(staticChk,
+                              buildIfStmt(dynChk, fast, fallback),
+                              forall));
+
+  // Now that the copy is in the tree, rewrite its accesses.
+  accesses.clear();
+  bases.clear();
+
+  findLocalAccesses(fast, accesses, bases);
+
+  for_vector(CallExpr, access, accesses) {
+    Expr* base = access->baseExpr->remove();
+    Expr* idx  = access->get(1)->remove();
+
+    access->replace(new CallExpr(buildDotExpr(base, "localAccess"), idx));
+  }
+}
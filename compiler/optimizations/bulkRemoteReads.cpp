@@ -0,0 +1,442 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/************************************* | **************************************
+*                                                                             *
+* Bulk remote reads                                                           *
+*                                                                             *
+* After insertWideReferences, a loop such as                                  *
+*                                                                             *
+*   for i in lo..hi do sum += A[i];                                           *
+*                                                                             *
+* that runs on a different locale than A's data becomes a C for loop whose    *
+* body contains                                                               *
+*                                                                             *
+*   (move ref  (array_get data i))      // data is a wide _ddata              *
+*   (move val  (deref ref))             // one GET per iteration              *
+*                                                                             *
+* This pass replaces the deref with                                           *
+*                                                                             *
+*   (move val  (chpl_comm_get_buffered ref last handle))                      *
+*                                                                             *
+* where 'last' is the address of data[hi] and 'handle' owns a read-ahead      *
+* window that the runtime refills with a single GET whenever the loop         *
+* steps outside of it, so the loop issues one GET per window rather than one  *
+* per element.  The window is released after the loop.                        *
+*                                                                             *
+* The transformation is only safe if nothing in the loop can modify the      *
+* remote data while the window is live, so we only consider loops whose       *
+* bodies are made up of a known set of side-effect free primitives, moves    *
+* into locals and stores through narrow references.  Narrow references can   *
+* only point to local memory, which the runtime never buffers.  Loops that   *
+* call functions, store through wide references or PUT are left alone.        *
+*                                                                             *
+* The window reads ahead up to data[hi], which is only known to be in bounds  *
+* if the loop reads every element up to it.  Reads under a conditional are    *
+* therefore left alone, since the condition may be what keeps the index in    *
+* range.                                                                      *
+*                                                                             *
+************************************** | *************************************/
+
+#include "optimizations.h"
+
+#include "astutil.h"
+#include "CForLoop.h"
+#include "driver.h"
+#include "expr.h"
+#include "stlUtil.h"
+#include "stmt.h"
+
+#include <map>
+#include <vector>
+
+struct BufferedRead {
+  CallExpr* arrayGet;   // (move ref (array_get data i))
+  CallExpr* deref;      // (move val (deref ref))
+};
+
+struct ReadBuffer {
+  VarSymbol* handle;
+  VarSymbol* last;
+};
+
+static bool      isUnitStrideLoop(CForLoop* loop, Symbol*& index, Expr*& hi);
+static bool      isDefinedBefore(Symbol* sym, Expr* loop);
+static bool      isDefinedIn(Symbol* sym, CForLoop* loop);
+static bool      isConditionalIn(Expr* expr, CForLoop* loop);
+static bool      isSafeLoopBody(CForLoop* loop);
+static bool      isSafePrimitive(CallExpr* call);
+static CallExpr* bufferedDeref(CallExpr* call, Symbol* index, CForLoop* loop);
+static void      bufferReads(CForLoop*                   loop,
+                             Expr*                       hi,
+                             std::vector<BufferedRead>&  reads);
+
+void bulkRemoteReads() {
+  if (fNoBulkRemoteReads == true || fLLVMWideOpt == true || fLocal == true)
+    return;
+
+  forv_Vec(BlockStmt, block, gBlockStmts) {
+    if (block->inTree() == false || block->isCForLoop() == false)
+      continue;
+
+    CForLoop* loop  = toCForLoop(block);
+    Symbol*   index = NULL;
+    Expr*     hi    = NULL;
+
+    if (isUnitStrideLoop(loop, index, hi) == false ||
+        isSafeLoopBody(loop)              == false)
+      continue;
+
+    std::vector<CallExpr*>    calls;
+    std::vector<BufferedRead> reads;
+
+    collectCallExprs(loop, calls);
+
+    for_vector(CallExpr, call, calls) {
+      if (CallExpr* deref = bufferedDeref(call, index, loop)) {
+        BufferedRead read = { call, deref };
+
+        reads.push_back(read);
+      }
+    }
+
+    if (reads.size() > 0)
+      bufferReads(loop, hi, reads);
+  }
+}
+
+//
+// Matches
+//   init: (= i lo)   test: (<= i hi)   incr: (+= i 1)
+// where neither 'i' nor 'hi' is modified in the body.
+//
+static bool isUnitStrideLoop(CForLoop* loop, Symbol*& index, Expr*& hi) {
+  BlockStmt* testBlock = loop->testBlockGet();
+  BlockStmt* incrBlock = loop->incrBlockGet();
+
+  if (testBlock == NULL || testBlock->body.length != 1 ||
+      incrBlock == NULL || incrBlock->body.length != 1)
+    return false;
+
+  CallExpr* test = toCallExpr(testBlock->body.only());
+  CallExpr* incr = toCallExpr(incrBlock->body.only());
+
+  if (test == NULL || test->isPrimitive(PRIM_LESSOREQUAL) == false ||
+      incr == NULL || incr->isPrimitive(PRIM_ADD_ASSIGN)  == false)
+    return false;
+
+  SymExpr* testIdx  = toSymExpr(test->get(1));
+  SymExpr* testHi   = toSymExpr(test->get(2));
+  SymExpr* incrIdx  = toSymExpr(incr->get(1));
+  SymExpr* incrStep = toSymExpr(incr->get(2));
+
+  if (testIdx == NULL || testHi == NULL || incrIdx == NULL || incrStep == NULL)
+    return false;
+
+  if (testIdx->symbol() != incrIdx->symbol() ||
+      testIdx->isRefOrWideRef() == true)
+    return false;
+
+  int64_t step = 0;
+
+  if (get_int(incrStep, &step) == false || step != 1)
+    return false;
+
+  index = testIdx->symbol();
+
+  if (isDefinedIn(index, loop) == true)
+    return false;
+
+  if (VarSymbol* var = toVarSymbol(testHi->symbol())) {
+    if (var->immediate == NULL &&
+        (var->isRefOrWideRef()       == true  ||
+         isDefinedIn(var, loop)      == true  ||
+         isDefinedBefore(var, loop)  == false))
+      return false;
+  } else if (testHi->isRefOrWideRef() == true) {
+    return false;
+  }
+
+  hi = testHi;
+
+  return true;
+}
+
+//
+// True if every definition of 'sym' in its function is a statement that
+// precedes 'loop' in the loop's own block or in one of its enclosing blocks.
+// Formals and globals are defined on entry.
+//
+static bool isDefinedBefore(Symbol* sym, Expr* loop) {
+  if (sym->defPoint->parentSymbol != loop->parentSymbol)
+    return isArgSymbol(sym) || isModuleSymbol(sym->defPoint->parentSymbol);
+
+  for_SymbolDefs(def, sym) {
+    Expr* stmt  = def->getStmtExpr();
+    bool  found = false;
+
+    for (Expr* cur = loop; cur != NULL && found == false;
+         cur = cur->parentExpr) {
+      for (Expr* prev = cur->prev; prev != NULL; prev = prev->prev) {
+        if (prev == stmt) {
+          found = true;
+          break;
+        }
+      }
+    }
+
+    if (found == false)
+      return false;
+  }
+
+  return true;
+}
+
+//
+// True if 'sym' is defined in the body of 'loop'.  The loop header is
+// not considered part of the body.
+//
+static bool isDefinedIn(Symbol* sym, CForLoop* loop) {
+  for_SymbolDefs(def, sym) {
+    for (Expr* cur = def->parentExpr; cur != NULL; cur = cur->parentExpr) {
+      if (cur == loop->initBlockGet() ||
+          cur == loop->testBlockGet() ||
+          cur == loop->incrBlockGet())
+        break;
+
+      if (cur == loop)
+        return true;
+    }
+  }
+
+  return false;
+}
+
+//
+// True if 'expr' is within a conditional in the body of 'loop'.
+//
+static bool isConditionalIn(Expr* expr, CForLoop* loop) {
+  for (Expr* cur = expr->parentExpr; cur != loop; cur = cur->parentExpr) {
+    if (isCondStmt(cur) == true)
+      return true;
+  }
+
+  return false;
+}
+
+static bool isSafeLoopBody(CForLoop* loop) {
+  std::vector<BaseAST*> asts;
+
+  collect_asts(loop, asts);
+
+  for_vector(BaseAST, ast, asts) {
+    if (isGotoStmt(ast) == true)
+      return false;
+
+    if (BlockStmt* block = toBlockStmt(ast)) {
+      if (block != loop && block->isLoopStmt() == true)
+        return false;
+
+    } else if (CallExpr* call = toCallExpr(ast)) {
+      if (call->primitive == NULL || isSafePrimitive(call) == false)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+static bool isSafePrimitive(CallExpr* call) {
+  switch (call->primitive->tag) {
+  case PRIM_MOVE:
+    // Moving an address into a reference does not store anything.
+    if (call->get(2)->isRefOrWideRef() == true)
+      return true;
+
+    // Fall through
+
+  case PRIM_ASSIGN:
+  case PRIM_ADD_ASSIGN:
+  case PRIM_SUBTRACT_ASSIGN:
+  case PRIM_MULT_ASSIGN:
+  case PRIM_DIV_ASSIGN:
+  case PRIM_MOD_ASSIGN:
+  case PRIM_LSH_ASSIGN:
+  case PRIM_RSH_ASSIGN:
+  case PRIM_AND_ASSIGN:
+  case PRIM_OR_ASSIGN:
+  case PRIM_XOR_ASSIGN:
+  case PRIM_SET_MEMBER:
+  case PRIM_SET_SVEC_MEMBER:
+  case PRIM_ARRAY_SET:
+  case PRIM_ARRAY_SET_FIRST:
+    // Stores through wide references might hit the buffered data.
+    return call->get(1)->isWideRef() == false &&
+           call->get(1)->typeInfo()->symbol->hasFlag(FLAG_WIDE_CLASS) == false;
+
+  case PRIM_NOOP:
+  case PRIM_DEREF:
+  case PRIM_ADDR_OF:
+  case PRIM_SET_REFERENCE:
+  case PRIM_UNARY_MINUS:
+  case PRIM_UNARY_PLUS:
+  case PRIM_UNARY_NOT:
+  case PRIM_UNARY_LNOT:
+  case PRIM_ADD:
+  case PRIM_SUBTRACT:
+  case PRIM_MULT:
+  case PRIM_DIV:
+  case PRIM_MOD:
+  case PRIM_LSH:
+  case PRIM_RSH:
+  case PRIM_EQUAL:
+  case PRIM_NOTEQUAL:
+  case PRIM_LESSOREQUAL:
+  case PRIM_GREATEROREQUAL:
+  case PRIM_LESS:
+  case PRIM_GREATER:
+  case PRIM_AND:
+  case PRIM_OR:
+  case PRIM_XOR:
+  case PRIM_POW:
+  case PRIM_MIN:
+  case PRIM_MAX:
+  case PRIM_CAST:
+  case PRIM_GET_REAL:
+  case PRIM_GET_IMAG:
+  case PRIM_GET_MEMBER:
+  case PRIM_GET_MEMBER_VALUE:
+  case PRIM_GET_SVEC_MEMBER:
+  case PRIM_GET_SVEC_MEMBER_VALUE:
+  case PRIM_ARRAY_GET:
+  case PRIM_ARRAY_GET_VALUE:
+  case PRIM_WIDE_GET_LOCALE:
+  case PRIM_WIDE_GET_NODE:
+  case PRIM_WIDE_GET_ADDR:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+//
+// Given (move ref (array_get data index)), return the only use of 'ref'
+// if it is (move val (deref ref)) in the same loop.
+//
+static CallExpr* bufferedDeref(CallExpr* call, Symbol* index, CForLoop* loop) {
+  if (call->isPrimitive(PRIM_MOVE) == false)
+    return NULL;
+
+  SymExpr*  lhs = toSymExpr(call->get(1));
+  CallExpr* rhs = toCallExpr(call->get(2));
+
+  if (lhs == NULL || lhs->isWideRef() == false ||
+      rhs == NULL || rhs->isPrimitive(PRIM_ARRAY_GET) == false)
+    return NULL;
+
+  SymExpr* data = toSymExpr(rhs->get(1));
+  SymExpr* idx  = toSymExpr(rhs->get(2));
+
+  if (data == NULL || idx == NULL || idx->symbol() != index ||
+      data->typeInfo()->symbol->hasFlag(FLAG_WIDE_CLASS) == false ||
+      data->isRefOrWideRef()             == true  ||
+      isDefinedIn(data->symbol(), loop)     == true  ||
+      isDefinedBefore(data->symbol(), loop) == false ||
+      isConditionalIn(call, loop)           == true)
+    return NULL;
+
+  Type* eltType = lhs->getValType();
+
+  if (eltType->symbol->hasEitherFlag(FLAG_REF, FLAG_WIDE_REF) == true)
+    return NULL;
+
+  SymExpr* use  = NULL;
+  int      defs = 0;
+
+  for_SymbolSymExprs(se, lhs->symbol()) {
+    if (se == lhs) {
+      defs++;
+    } else if (use == NULL) {
+      use = se;
+    } else {
+      return NULL;
+    }
+  }
+
+  if (defs != 1 || use == NULL)
+    return NULL;
+
+  CallExpr* deref = toCallExpr(use->parentExpr);
+  CallExpr* move  = deref ? toCallExpr(deref->parentExpr) : NULL;
+
+  if (deref == NULL || deref->isPrimitive(PRIM_DEREF) == false ||
+      move  == NULL || move->isPrimitive(PRIM_MOVE)   == false ||
+      move->get(1)->isRefOrWideRef() == true)
+    return NULL;
+
+  return move;
+}
+
+static void bufferReads(CForLoop*                  loop,
+                        Expr*                      hi,
+                        std::vector<BufferedRead>& reads) {
+  SET_LINENO(loop);
+
+  std::map<Symbol*, ReadBuffer> buffers;
+
+  for (size_t i = 0; i < reads.size(); i++) {
+    BufferedRead& read     = reads[i];
+    CallExpr* arrayGet = toCallExpr(read.arrayGet->get(2));
+    Symbol*   data     = toSymExpr(arrayGet->get(1))->symbol();
+    Symbol*   ref      = toSymExpr(read.arrayGet->get(1))->symbol();
+
+    if (buffers.count(data) == 0) {
+      ReadBuffer buf;
+
+      buf.handle = newTemp("bulk_read_handle", dtCVoidPtr);
+      buf.last   = newTemp("bulk_read_last", ref->qualType());
+
+      loop->insertBefore(new DefExpr(buf.handle));
+      loop->insertBefore(new CallExpr(PRIM_MOVE, buf.handle,
+                                      new CallExpr(PRIM_CAST,
+                                                   dtCVoidPtr->symbol,
+                                                   gNil)));
+
+      loop->insertBefore(new DefExpr(buf.last));
+      loop->insertBefore(new CallExpr(PRIM_MOVE, buf.last,
+                                      new CallExpr(PRIM_ARRAY_GET,
+                                                   data,
+                                                   hi->copy())));
+
+      loop->insertAfter(new CallExpr(PRIM_CHPL_COMM_GET_BUFFER_FREE,
+                                     buf.handle));
+
+      buffers[data] = buf;
+    }
+
+    ReadBuffer& buf   = buffers[data];
+    CallExpr*   deref = toCallExpr(read.deref->get(2));
+
+    deref->replace(new CallExpr(PRIM_CHPL_COMM_GET_BUFFERED,
+                                ref,
+                                buf.last,
+                                buf.handle));
+  }
+}
@@ -371,6 +371,13 @@ static bool isUse(SymExpr* se)
       }
       return false;
 
+     case PRIM_CHPL_COMM_GET_BUFFERED:
+     case PRIM_CHPL_COMM_GET_BUFFER_FREE:
+      // ('comm_get_buffered' widePtr lastWidePtr handle) and
+      // ('comm_get_buffer_free' handle)
+      // All operands are treated as addresses.
+      return false;
+
      case PRIM_CHPL_COMM_REMOTE_PREFETCH:
       // comm prefetch locale widePtr len
       // second argument is an address
@@ -248,6 +248,8 @@ classifyPrimitive(CallExpr *call) {
   case PRIM_CHPL_COMM_REMOTE_PREFETCH:
   case PRIM_CHPL_COMM_GET_STRD:
   case PRIM_CHPL_COMM_PUT_STRD:
+  case PRIM_CHPL_COMM_GET_BUFFERED:
+  case PRIM_CHPL_COMM_GET_BUFFER_FREE:
     // These involve communication
     // MPF: Couldn't these be fast if in a local block?
     // Shouldn't this be return FAST_NOT_LOCAL ?
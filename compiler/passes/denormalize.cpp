@@ -430,6 +430,8 @@ bool isDenormalizable(Symbol* sym,
                   ce->isPrimitive(PRIM_GET_MEMBER) ||
                   ce->isPrimitive(PRIM_DEREF) ||
                   ce->isPrimitive(PRIM_GET_MEMBER_VALUE) ||
+                  ce->isPrimitive(PRIM_CHPL_COMM_GET_BUFFERED) ||
+                  ce->isPrimitive(PRIM_CHPL_COMM_GET_BUFFER_FREE) ||
                   ce->isPrimitive(PRIM_RETURN) ||
                   (ce->isPrimitive(PRIM_ARRAY_SHIFT_BASE_POINTER) && ce->get(1) == se) ||
                   isBadMove(ce) ||
@@ -2533,6 +2533,8 @@ insertWideReferences(void) {
 
   handleIsWidePointer();
 
+  bulkRemoteReads();
+
 
 #ifdef PRINT_WIDEN_SUMMARY
   printf("Spent %2.3f seconds propagating vars\n", debugTimer.elapsedSecs());
@@ -33,6 +33,7 @@
 #include "initializerRules.h"
 #include "library.h"
 #include "LoopExpr.h"
+#include "optimizations.h"
 #include "stlUtil.h"
 #include "stringutil.h"
 #include "TransformLogicalShortCircuit.h"
@@ -116,6 +117,8 @@ static bool        firstConstructorWarning = true;
 void normalize() {
   insertModuleInit();
 
+  autoLocalAccess();
+
   transformLogicalShortCircuit();
 
   checkReduceAssign();
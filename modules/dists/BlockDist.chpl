@@ -1036,6 +1036,9 @@ proc BlockArr.dsiDynamicFastFollowCheck(lead: [])
 proc BlockArr.dsiDynamicFastFollowCheck(lead: domain)
   return _to_borrowed(lead._value) == _to_borrowed(this.dom);
 
+proc BlockArr.dsiStaticAutoLocalCheck(type iterandType) param
+  return _to_borrowed(iterandType) == _to_borrowed(this.dom.type);
+
 iter BlockArr.these(param tag: iterKind, followThis, param fast: bool = false) ref where tag == iterKind.follower {
   proc anyStridable(rangeTuple, param i: int = 1) param
       return if i == rangeTuple.size then rangeTuple(i).stridable
@@ -1130,7 +1133,7 @@ proc BlockArr.dsiSerialWrite(f) {
         if i(dim) <= (dom.dsiDim(dim).high - dom.dsiDim(dim).stride:strType) {
           i(dim) += dom.dsiDim(dim).stride:strType;
           for dim2 in dim+1..rank {
-            f <~> "\n";
+            if ! binary then f <~> "\n";
             i(dim2) = dom.dsiDim(dim2).low;
           }
           continue next;
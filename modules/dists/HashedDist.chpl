@@ -98,6 +98,19 @@ mapper computes the target locale based upon a hash of the index.
     writeln(key, " -> ", value);
   }
 
+Adding many indices, testing many indices for membership, or reading or
+writing many array elements at once is faster with the bulk versions of
+these operations, since they communicate with each locale once rather than
+once per index:
+
+.. code-block:: chapel
+
+  var keys = ["three", "four", "five"];
+  D.bulkAdd(keys);
+  A.bulkSet(keys, [3, 4, 5]);
+  const present = D.bulkContains(["one", "six"]); // [true, false]
+  const values = A.bulkGet(keys);                 // [3, 4, 5]
+
 
 **Initializer Arguments**
 
@@ -329,6 +342,105 @@ class UserMapAssocDom: BaseAssociativeDom {
     return locDoms(dist.indexToLocaleIndex(i)).contains(i);
   }
 
+  //
+  // Bulk operations: rather than communicating with the owner of each index
+  // separately, the indices are bucketed by owner, each owner gets its
+  // bucket in one transfer, and it processes the bucket in parallel.
+  //
+  proc dsiBulkAdd(inds: [] idxType, dataSorted=false, isUnique=false,
+                  preserveInds=true) {
+    const (locStart, routed, _) = routeByLocale(inds);
+    var numAdded = 0;
+    coforall l in dist.targetLocDom with (+ reduce numAdded) {
+      const lo = locStart[l], cnt = locStart[l+1] - lo;
+      const locDom = locDoms[l];
+      if cnt > 0 then on locDom {
+        const myInds: [0..#cnt] idxType = routed[lo..#cnt];
+        numAdded += locDom.myInds.bulkAdd(myInds);
+      }
+    }
+    return numAdded;
+  }
+
+  proc dsiBulkContains(inds: [] idxType) {
+    const (locStart, routed, routedFrom) = routeByLocale(inds);
+    var found: [routed.domain] bool;
+    coforall l in dist.targetLocDom {
+      const lo = locStart[l], cnt = locStart[l+1] - lo;
+      const locDom = locDoms[l];
+      if cnt > 0 then on locDom {
+        const myInds: [0..#cnt] idxType = routed[lo..#cnt];
+        var myFound: [0..#cnt] bool;
+        forall (f, i) in zip(myFound, myInds) do
+          f = locDom.contains(i);
+        found[lo..#cnt] = myFound;
+      }
+    }
+
+    var result: [inds.domain] bool;
+    forall (f, from) in zip(found, routedFrom) do
+      result[from] = f;
+    return result;
+  }
+
+  //
+  // Bucket the indices in 'inds' by the locale that owns them, with a
+  // stable counting sort.  Returns the start of each locale's bucket (plus
+  // the end of the last one), the bucketed indices, and the position in
+  // 'inds' that each bucketed index came from.
+  //
+  proc routeByLocale(inds: [] idxType) {
+    use RangeChunk;
+
+    const numLocs = dist.targetLocDom.size;
+    const indsRange = inds.domain.dim(1);
+    const numTasks = max(1, min(indsRange.size,
+                                if dataParTasksPerLocale == 0
+                                  then here.maxTaskPar
+                                  else dataParTasksPerLocale));
+
+    var owner: [inds.domain] int;
+    forall (o, i) in zip(owner, inds) do
+      o = dist.indexToLocaleIndex(i);
+
+    // counts[t, l] is the number of indices task t routes to locale l, and
+    // then where the first of them goes
+    var counts: [0..#numTasks, 0..#numLocs] int;
+    // chunk by position, since chunk() does not handle strided ranges
+    const positions = 0..#indsRange.size;
+    coforall t in 0..#numTasks {
+      for p in chunk(positions, numTasks, t) do
+        counts[t, owner[indsRange.orderToIndex(p)]] += 1;
+    }
+
+    var locStart: [0..numLocs] int;
+    var pos = 0;
+    for l in 0..#numLocs {
+      locStart[l] = pos;
+      for t in 0..#numTasks {
+        const cnt = counts[t, l];
+        counts[t, l] = pos;
+        pos += cnt;
+      }
+    }
+    locStart[numLocs] = pos;
+
+    var routed: [0..#indsRange.size] idxType;
+    var routedFrom: [0..#indsRange.size] indsRange.idxType;
+    coforall t in 0..#numTasks {
+      var next: [0..#numLocs] int = counts[t, ..];
+      for p in chunk(positions, numTasks, t) {
+        const i = indsRange.orderToIndex(p);
+        const l = owner[i];
+        routed[next[l]] = inds[i];
+        routedFrom[next[l]] = i;
+        next[l] += 1;
+      }
+    }
+
+    return (locStart, routed, routedFrom);
+  }
+
   override proc dsiClear() {
     for locDom in locDoms do on locDom {
       locDom.clear();
@@ -762,6 +874,51 @@ class UserMapAssocArr: AbsBaseArr {
     return locArr[i];
   }
 
+  //
+  // Bulk gather and scatter, bucketing the indices by owner as for the
+  // domain's bulk operations
+  //
+  proc dsiBulkGet(inds: [] idxType) {
+    const (locStart, routed, routedFrom) = dom.routeByLocale(inds);
+    var vals: [routed.domain] eltType;
+    coforall l in dom.dist.targetLocDom {
+      const lo = locStart[l], cnt = locStart[l+1] - lo;
+      const locArr = locArrs[l];
+      if cnt > 0 then on locArr {
+        const myInds: [0..#cnt] idxType = routed[lo..#cnt];
+        var myVals: [0..#cnt] eltType;
+        forall (v, i) in zip(myVals, myInds) do
+          v = locArr[i];
+        vals[lo..#cnt] = myVals;
+      }
+    }
+
+    var result: [inds.domain] eltType;
+    forall (v, from) in zip(vals, routedFrom) do
+      result[from] = v;
+    return result;
+  }
+
+  proc dsiBulkSet(inds: [] idxType, vals: [] eltType) {
+    const (locStart, routed, routedFrom) = dom.routeByLocale(inds);
+    // 'vals' pairs with 'inds' by position, not by index
+    const indsRange = inds.domain.dim(1), valsRange = vals.domain.dim(1);
+    var routedVals: [routed.domain] eltType;
+    forall (v, from) in zip(routedVals, routedFrom) do
+      v = vals[valsRange.orderToIndex(indsRange.indexOrder(from))];
+
+    coforall l in dom.dist.targetLocDom {
+      const lo = locStart[l], cnt = locStart[l+1] - lo;
+      const locArr = locArrs[l];
+      if cnt > 0 then on locArr {
+        const myInds: [0..#cnt] idxType = routed[lo..#cnt];
+        const myVals: [0..#cnt] eltType = routedVals[lo..#cnt];
+        forall (i, v) in zip(myInds, myVals) do
+          locArr[i] = v;
+      }
+    }
+  }
+
   proc dsiTargetLocales() {
     return dom.dist.targetLocales;
   }
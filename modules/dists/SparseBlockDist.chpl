@@ -46,17 +46,6 @@ config param debugSparseBlockDistBulkTransfer = false;
 // There is no SparseBlock distribution class. Instead, we
 // just use Block.
 
-// Helper type for sorting locales
-record TargetLocaleComparator {
-  param rank;
-  type idxType;
-  type sparseLayoutType;
-  var dist: unmanaged Block(rank, idxType, sparseLayoutType);
-  proc key(a: index(rank, idxType)) {
-    return (dist.targetLocsIdx(a), a);
-  }
-}
-
 
 //
 // SparseBlock Domain Class
@@ -139,44 +128,68 @@ class SparseBlockDom: BaseSparseDomImpl {
 
   override proc bulkAdd_help(inds: [] index(rank,idxType),
       dataSorted=false, isUnique=false) {
-    use Sort;
-    use Search;
-
-    // without _new_, record functions throw null deref
-    var comp = new TargetLocaleComparator(rank=rank, idxType=idxType,
-                                          sparseLayoutType=sparseLayoutType,
-                                          dist=dist);
-
-    if !dataSorted then sort(inds, comparator=comp);
-
-    var localeRanges: [dist.targetLocDom] range;
-    on inds {
-      for l in dist.targetLocDom {
-        const _first = locDoms[l].mySparseBlock._value.parentDom.first;
-        const _last = locDoms[l].mySparseBlock._value.parentDom.last;
-
-        var (foundFirst, locFirst) = binarySearch(inds, _first, comp);
-        var (foundLast, locLast) = binarySearch(inds, _last, comp);
-
-        if !foundLast then locLast -= 1;
+    use RangeChunk;
+
+    // Route the indices to the locales that own them with a stable
+    // counting sort, so that each locale can fetch its indices with one
+    // bulk transfer and add them locally.  Indices outside the bounding
+    // box go to the nearest locale, whose bulkAdd call catches them when
+    // bounds checking is on.
+    const numLocs = dist.targetLocDom.size;
+    const indsRange = inds.domain.dim(1);
+    const numTasks = max(1, min(indsRange.size,
+                                if dataParTasksPerLocale == 0
+                                  then here.maxTaskPar
+                                  else dataParTasksPerLocale));
+
+    inline proc locOrder(ind) {
+      return dist.targetLocDom.indexOrder(dist.targetLocsIdx(ind));
+    }
 
-        // two ifs are necessary to catch out of bounds in the bulkAdd call
-        // chain. otherwise this methods would cutoff indices that are smaller
-        // than parentDom.first or larger than parentDom.last, which is
-        // _probably_ not desirable.
-        if dist.targetLocDom.first == l then
-          locFirst = inds.domain.first;
-        if dist.targetLocDom.last == l then
-          locLast = inds.domain.last;
+    // counts[t, l] is the number of indices task t routes to locale l, and
+    // then where the first of them goes
+    var counts: [0..#numTasks, 0..#numLocs] int;
+    coforall t in 0..#numTasks {
+      for i in chunk(indsRange, numTasks, t) do
+        counts[t, locOrder(inds[i])] += 1;
+    }
 
-        localeRanges[l] = locFirst..locLast;
+    var locStart: [0..numLocs] int;
+    var pos = 0;
+    for l in 0..#numLocs {
+      locStart[l] = pos;
+      for t in 0..#numTasks {
+        const cnt = counts[t, l];
+        counts[t, l] = pos;
+        pos += cnt;
+      }
+    }
+    locStart[numLocs] = pos;
+
+    var routed: [0..#indsRange.size] index(rank, idxType);
+    coforall t in 0..#numTasks {
+      var next: [0..#numLocs] int = counts[t, ..];
+      for i in chunk(indsRange, numTasks, t) {
+        const l = locOrder(inds[i]);
+        routed[next[l]] = inds[i];
+        next[l] += 1;
       }
     }
+
+    // Routing preserves the order of the indices, so each locale's indices
+    // are sorted if all of them were
     var _totalAdded: atomic int;
-    coforall l in dist.targetLocDom do on dist.targetLocales[l] {
-      const _retval = locDoms[l].mySparseBlock.bulkAdd(inds[localeRanges[l]],
-          dataSorted=true, isUnique=false);
-      _totalAdded.add(_retval);
+    coforall (l, locIdx) in zip(0..#numLocs, dist.targetLocDom) {
+      on dist.targetLocales[locIdx] {
+        const myCount = locStart[l+1] - locStart[l];
+        if myCount > 0 {
+          var myInds: [0..#myCount] index(rank, idxType) =
+            routed[locStart[l]..#myCount];
+          const _retval = locDoms[locIdx].mySparseBlock.bulkAdd(myInds,
+              dataSorted, isUnique, preserveInds=false);
+          _totalAdded.add(_retval);
+        }
+      }
     }
     const _retval = _totalAdded.read();
     nnz += _retval;
@@ -60,6 +60,16 @@ config param stencilDistAllowPackedUpdateFluff = true;
 // TODO: find better heuristic through experimentation
 config const stencilDistPackedUpdateMinChunks = 1;
 
+extern type chpl_comm_nb_handle_t = c_void_ptr;
+private extern const CHPL_TYPE_uint8_t : int(32);
+private extern const CHPL_COMM_UNKNOWN_ID : int(32);
+private extern proc chpl_comm_get_nb(addr: c_void_ptr, node: int(32),
+                                     raddr: c_void_ptr, size: size_t,
+                                     typeIndex: int(32), commID: int(32),
+                                     ln: c_int, fn: int(32)) : chpl_comm_nb_handle_t;
+private extern proc chpl_comm_wait_nb_some(h: c_ptr(chpl_comm_nb_handle_t),
+                                           nhandles: size_t);
+
 // Re-uses these flags from BlockDist:
 //   - disableAliasedBulkTransfer
 //   - sanityCheckDistribution
@@ -209,6 +219,24 @@ config param disableStencilLazyRAD = defaultDisableLazyRADOpt;
   After updating, any read from the array should be up-to-date. The
   ``updateFluff`` function does not currently accept any arguments.
 
+  The update can also be split into two calls so that computation can
+  overlap with the communication. ``startFluffUpdate`` begins the update and
+  returns once the data has been requested from the neighboring locales,
+  and ``finishFluffUpdate`` waits for it to arrive and stores it in the
+  ghost cells. In between, the cached elements may still hold old values, and
+  the array elements must not be written. The ``interiorIndices`` and
+  ``boundaryIndices`` iterators on a Stencil-distributed domain split its
+  indices into those whose neighbors within the ``fluff`` distance are all
+  owned by the same locale, and the rest. Together they yield each index
+  once:
+
+  .. code-block:: chapel
+
+    A.startFluffUpdate();
+    forall idx in Space.interiorIndices() do B[idx] = f(A, idx);
+    A.finishFluffUpdate();
+    forall idx in Space.boundaryIndices() do B[idx] = f(A, idx);
+
   **Reading and Writing to Array Elements**
 
   The Stencil distribution uses ghost cells as cached read-only values from
@@ -296,6 +324,10 @@ class StencilDom: BaseRectangularDom {
 // idxType: generic domain index type
 // stridable: generic domain stridable parameter
 // myBlock: a non-distributed domain that defines the local indices
+// myInterior: the indices in myBlock whose neighbors within the fluff
+//             distance are all in myBlock
+// myBoundary: up to 2*rank non-overlapping domains covering the indices in
+//             myBlock that are not in myInterior
 //
 // NeighDom will be a rectangular domain where each dimension is the range
 // -1..1
@@ -310,6 +342,8 @@ class LocStencilDom {
   var recvDest, recvSrc,
       sendDest, sendSrc: [NeighDom] domain(rank, idxType, stridable);
   var Neighs: [NeighDom] rank*int;
+  var myInterior: domain(rank, idxType, stridable);
+  var myBoundary: [1..2*rank] domain(rank, idxType, stridable);
 }
 
 //
@@ -358,6 +392,16 @@ class LocStencilArr {
   var recvBufs, sendBufs : [locDom.NeighDom] [locDom.bufDom] eltType;
   var sendRecvFlag : [locDom.NeighDom] atomic bool;
 
+  // State for startFluffUpdate and finishFluffUpdate. The address of each
+  // neighbor's send buffer is looked up once and kept in fluffSrcNode and
+  // fluffSrcAddr until the domain is reallocated.
+  var sendBufAddr : [locDom.NeighDom] c_void_ptr;
+  var fluffPlanValid : bool;
+  var fluffSrcNode : [locDom.NeighDom] int(32);
+  var fluffSrcAddr : [locDom.NeighDom] c_void_ptr;
+  var fluffHandles : [locDom.NeighDom] chpl_comm_nb_handle_t;
+  var fluffPending : bool;
+
   // These functions will always be called on this.locale, and so we do
   // not have an on statement around the while loop below (to avoid
   // the repeated on's from calling testAndSet()).
@@ -740,6 +784,42 @@ iter StencilDom.these(param tag: iterKind, followThis) where tag == iterKind.fol
   }
 }
 
+//
+// Yield the indices of the domain that can be computed from the elements
+// each locale owns, without reading any cached fluff elements.
+//
+iter StencilDom.interiorIndices() {
+  for i in dist.targetLocDom do
+    for idx in locDoms[i].myInterior do yield idx;
+}
+
+iter StencilDom.interiorIndices(param tag: iterKind) where tag == iterKind.standalone {
+  coforall i in dist.targetLocDom {
+    on dist.targetLocales(i) {
+      forall idx in locDoms[i].myInterior do yield idx;
+    }
+  }
+}
+
+//
+// Yield the remaining indices of the domain, whose neighbors within the
+// fluff distance include cached elements.
+//
+iter StencilDom.boundaryIndices() {
+  for i in dist.targetLocDom do
+    for D in locDoms[i].myBoundary do
+      for idx in D do yield idx;
+}
+
+iter StencilDom.boundaryIndices(param tag: iterKind) where tag == iterKind.standalone {
+  coforall i in dist.targetLocDom {
+    on dist.targetLocales(i) {
+      for D in locDoms[i].myBoundary do
+        forall idx in D do yield idx;
+    }
+  }
+}
+
 //
 // output domain
 //
@@ -850,6 +930,36 @@ proc StencilDom.setup() {
         myLocDom.myFluff = myLocDom.myBlock;
       }
 
+      //
+      // Split myBlock into the indices that can be computed without reading
+      // any fluff and the slabs around them. Slab 2*d-1 and 2*d hold the
+      // indices below and above the interior in dimension 'd', limited to
+      // the interior in the dimensions before 'd'.
+      //
+      const outer = myLocDom.myBlock.dims();
+      var inner = outer;
+      for param d in 1..rank do
+        inner(d) = outer(d).expand(-fluff(d) * abstr(d));
+      myLocDom.myInterior = {(...inner)};
+      if myLocDom.myInterior.size == 0 {
+        var empty: domain(rank, idxType, stridable);
+        myLocDom.myInterior = empty;
+        myLocDom.myBoundary = empty;
+        myLocDom.myBoundary[1] = myLocDom.myBlock;
+      } else {
+        for param d in 1..rank {
+          var lo, hi : rank*range(idxType, BoundedRangeType.bounded, stridable);
+          for param j in 1..rank {
+            lo(j) = if j < d then inner(j) else outer(j);
+            hi(j) = lo(j);
+          }
+          lo(d) = outer(d)[..inner(d).low-1];
+          hi(d) = outer(d)[inner(d).high+1..];
+          myLocDom.myBoundary[2*d-1] = {(...lo)};
+          myLocDom.myBoundary[2*d] = {(...hi)};
+        }
+      }
+
       if !isZeroTuple(fluff) && myLocDom.myBlock.size > 0 {
         //
         // Recompute Src and Dest domains, later used to update fluff regions
@@ -1174,6 +1284,9 @@ proc StencilArr.dsiDynamicFastFollowCheck(lead: [])
 proc StencilArr.dsiDynamicFastFollowCheck(lead: domain)
   return _to_borrowed(lead._value) == _to_borrowed(this.dom);
 
+proc StencilArr.dsiStaticAutoLocalCheck(type iterandType) param
+  return _to_borrowed(iterandType) == _to_borrowed(this.dom.type);
+
 iter StencilArr.these(param tag: iterKind, followThis, param fast: bool = false) ref where tag == iterKind.follower {
   proc anyStridable(rangeTuple, param i: int = 1) param
       return if i == rangeTuple.size then rangeTuple(i).stridable
@@ -1495,6 +1608,14 @@ proc StencilArr.naiveUpdateFluff() {
 //    b) Bulk-copy the remote buffer into a local buffer
 //    c) Copy elements from the local buffer into the cache
 //
+// Returns true if the region 'S' should be communicated through the packed
+// send and receive buffers rather than with a direct array assignment.
+private proc usePackedBuffers(S) {
+  const chunkSize  = max(1, S.dim(S.rank).length); // avoid divide by zero
+  const numChunks = S.size / chunkSize;
+  return numChunks >= stencilDistPackedUpdateMinChunks;
+}
+
 proc StencilArr._packedUpdate() {
   coforall i in dom.dist.targetLocDom {
     on dom.dist.targetLocales(i) {
@@ -1512,9 +1633,7 @@ proc StencilArr._packedUpdate() {
                                                 myLocDom.NeighDom) {
         // If S.size == 0, no communication is required
         if S.size != 0 {
-          const chunkSize  = max(1, S.dim(rank).length); // avoid divide by zero
-          const numChunks = S.size / chunkSize;
-          if numChunks >= stencilDistPackedUpdateMinChunks {
+          if usePackedBuffers(S) {
             const recvBufIdx = translateIdx(sendBufIdx);
 
             // Pack the buffer
@@ -1537,12 +1656,9 @@ proc StencilArr._packedUpdate() {
       forall (D, S, srcIdx, recvBufIdx) in zip(myLocDom.recvDest, myLocDom.recvSrc,
                                                myLocDom.Neighs,
                                                myLocDom.NeighDom) {
-        const chunkSize  = max(1, S.dim(rank).length); // avoid divide by zero
-        const numChunks = S.size / chunkSize;
-
         // If we did a naive update in the previous loop, this iteration does
         // not need to do anything.
-        if S.size != 0 && numChunks >= stencilDistPackedUpdateMinChunks {
+        if S.size != 0 && usePackedBuffers(S) {
           const srcBufIdx = translateIdx(recvBufIdx);
           if debugStencilDist then
             writeln(here, "::", recvBufIdx, " WAITING");
@@ -1589,6 +1705,123 @@ proc StencilArr.updateFluff() {
   }
 }
 
+//
+// Split-phase variant of updateFluff. startFluffUpdate packs the regions
+// that neighbors will read and starts non-blocking GETs of the neighbors'
+// buffers; finishFluffUpdate waits for them and copies the data into the
+// caches. The array may be read and its interior written in between, but
+// the cached elements are only up to date after finishFluffUpdate.
+//
+// Unlike _packedUpdate, no flags are needed: every locale has packed its
+// buffers by the time the first coforall completes, and the buffers are
+// not touched again until finishFluffUpdate has waited for every GET.
+//
+// The node and address of each remote buffer are looked up on the first
+// call and kept in the LocStencilArr until the domain is reallocated.
+//
+proc StencilArr.startFluffUpdate() {
+  if isZeroTuple(dom.fluff) then return;
+
+  if !shouldDoPackedUpdate() || dom.dist.targetLocales.size == 1 {
+    // Nothing to overlap with; finishFluffUpdate has nothing left to do.
+    this.naiveUpdateFluff();
+    return;
+  }
+
+  coforall i in dom.dist.targetLocDom {
+    on dom.dist.targetLocales(i) {
+      const myLocArr = locArr[i];
+      ref myLocDom = myLocArr.locDom;
+
+      if myLocArr.fluffPending then
+        halt("startFluffUpdate called again before finishFluffUpdate");
+
+      forall (D, S, recvIdx, sendBufIdx) in zip(myLocDom.sendDest, myLocDom.sendSrc,
+                                                myLocDom.Neighs,
+                                                myLocDom.NeighDom) {
+        if S.size != 0 {
+          if usePackedBuffers(S) {
+            ref src = myLocArr.myElems[S];
+            ref buf = myLocArr.sendBufs[sendBufIdx];
+            local do for (s, j) in zip(src, buf.domain.first..#src.size) do buf[j] = s;
+            myLocArr.sendBufAddr[sendBufIdx] = c_ptrTo(buf[buf.domain.first]):c_void_ptr;
+          } else {
+            locArr[recvIdx].myElems[D] = myLocArr.myElems[S];
+          }
+        }
+      }
+    }
+  }
+
+  const ln = __primitive("_get_user_line"),
+        fn = __primitive("_get_user_file");
+
+  coforall i in dom.dist.targetLocDom {
+    on dom.dist.targetLocales(i) {
+      const myLocArr = locArr[i];
+      ref myLocDom = myLocArr.locDom;
+
+      for (D, S, srcIdx, recvBufIdx) in zip(myLocDom.recvDest, myLocDom.recvSrc,
+                                            myLocDom.Neighs,
+                                            myLocDom.NeighDom) {
+        if S.size != 0 && usePackedBuffers(S) {
+          if !myLocArr.fluffPlanValid {
+            const srcBufIdx = -1 * chpl__tuplify(recvBufIdx);
+            myLocArr.fluffSrcNode[recvBufIdx] = dom.dist.targetLocales(srcIdx).id:int(32);
+            myLocArr.fluffSrcAddr[recvBufIdx] = locArr[srcIdx].sendBufAddr[srcBufIdx];
+          }
+
+          ref buf = myLocArr.recvBufs[recvBufIdx];
+          myLocArr.fluffHandles[recvBufIdx] =
+            chpl_comm_get_nb(c_ptrTo(buf[buf.domain.first]):c_void_ptr,
+                             myLocArr.fluffSrcNode[recvBufIdx],
+                             myLocArr.fluffSrcAddr[recvBufIdx],
+                             D.size:size_t * c_sizeof(eltType),
+                             CHPL_TYPE_uint8_t, CHPL_COMM_UNKNOWN_ID,
+                             ln:c_int, fn:int(32));
+        }
+      }
+
+      myLocArr.fluffPlanValid = true;
+      myLocArr.fluffPending = true;
+    }
+  }
+}
+
+proc StencilArr.finishFluffUpdate() {
+  if isZeroTuple(dom.fluff) then return;
+
+  if !shouldDoPackedUpdate() || dom.dist.targetLocales.size == 1 then return;
+
+  coforall i in dom.dist.targetLocDom {
+    on dom.dist.targetLocales(i) {
+      const myLocArr = locArr[i];
+      ref myLocDom = myLocArr.locDom;
+
+      if myLocArr.fluffPending {
+        // wait_nb_some only waits until one of the handles it is given
+        // completes, so wait on each GET in turn.
+        for h in myLocArr.fluffHandles {
+          if h != c_nil then
+            chpl_comm_wait_nb_some(c_ptrTo(h), 1);
+          h = c_nil;
+        }
+
+        forall (D, S, recvBufIdx) in zip(myLocDom.recvDest, myLocDom.recvSrc,
+                                         myLocDom.NeighDom) {
+          if S.size != 0 && usePackedBuffers(S) {
+            ref dest = myLocArr.myElems[D];
+            ref buf = myLocArr.recvBufs[recvBufIdx];
+            local do for (d, j) in zip(dest, buf.domain.first..#dest.size) do d = buf[j];
+          }
+        }
+
+        myLocArr.fluffPending = false;
+      }
+    }
+  }
+}
+
 override proc StencilArr.dsiReallocate(bounds:rank*range(idxType,BoundedRangeType.bounded,stridable))
 {
   //
@@ -1607,6 +1840,11 @@ override proc StencilArr.dsiReallocate(bounds:rank*range(idxType,BoundedRangeTyp
 // Call this *after* the domain has been reallocated
 override proc StencilArr.dsiPostReallocate() {
   if doRADOpt then setupRADOpt();
+
+  // The send and receive buffers may have moved
+  coforall i in dom.dist.targetLocDom do
+    on dom.dist.targetLocales(i) do
+      locArr[i].fluffPlanValid = false;
 }
 
 proc StencilArr.setRADOpt(val=true) {
@@ -1452,11 +1452,19 @@ module ChapelArray {
        some cases, expensive operations can be avoided by setting those flags.
        To do so, ``bulkAdd`` must be called explicitly (instead of ``+=``).
 
+       The indices are sorted and merged into the domain using several
+       tasks.  For distributed sparse domains, the indices are routed to the
+       locales that own them in bulk, and each locale then adds its own
+       indices.
+
+       Associative domains also support this method, where it reserves
+       space for all of the indices at once rather than growing the domain
+       repeatedly. The flags are accepted, but they have no effect there.
+
        .. note::
 
-         Right now, this method and the corresponding ``+=`` operator are
-         only available for sparse domains. In the future, we expect that
-         these methods will be available for all irregular domains.
+         Right now, the ``+=`` operator with an array of indices is only
+         available for sparse domains.
 
        :arg inds: Indices to be added. ``inds`` can be an array of
                   ``rank*idxType`` or an array of ``idxType`` for
@@ -1474,7 +1482,7 @@ module ChapelArray {
        :returns: Number of indices added to the domain
        :rtype: int
     */
-    proc bulkAdd(inds: [] _value.rank*_value.idxType, dataSorted=false,
+    proc bulkAdd(inds: [] rank*_value.idxType, dataSorted=false,
         isUnique=false, preserveInds=true) where isSparseDom(this) && _value.rank>1 {
 
       if inds.size == 0 then return 0;
@@ -1482,6 +1490,42 @@ module ChapelArray {
       return _value.dsiBulkAdd(inds, dataSorted, isUnique, preserveInds);
     }
 
+    pragma "no doc"
+    proc bulkAdd(inds: [] _value.idxType, dataSorted=false,
+        isUnique=false, preserveInds=true) where isAssociativeDom(this) {
+
+      if inds.size == 0 then return 0;
+
+      use Reflection;
+      if canResolveMethod(_value, "dsiBulkAdd", inds, dataSorted, isUnique,
+                          preserveInds) {
+        return _value.dsiBulkAdd(inds, dataSorted, isUnique, preserveInds);
+      } else {
+        var added = 0;
+        for i in inds do added += add(i);
+        return added;
+      }
+    }
+
+    /*
+       Return an array of the same shape as ``inds`` indicating whether
+       this domain contains each of the indices in ``inds``.
+
+       This method is only available for associative domains. For
+       distributed associative domains, it asks each locale about all the
+       indices it owns at once, rather than one index at a time.
+     */
+    proc bulkContains(inds: [] _value.idxType) where isAssociativeDom(this) {
+      use Reflection;
+      if canResolveMethod(_value, "dsiBulkContains", inds) {
+        return _value.dsiBulkContains(inds);
+      } else {
+        var result: [inds.domain] bool;
+        forall (r, i) in zip(result, inds) do r = contains(i);
+        return result;
+      }
+    }
+
     /* Remove index ``i`` from this domain */
     proc remove(i) {
       return _value.dsiRemove(i);
@@ -2680,6 +2724,47 @@ module ChapelArray {
       return _value.IRV;
     }
 
+    /*
+       Return an array of the same shape as ``inds`` holding the elements of
+       this array at each of the indices in ``inds``.
+
+       This method is only available for associative arrays. For
+       distributed associative arrays, it reads all the elements each locale
+       owns at once, rather than one element at a time.
+     */
+    proc bulkGet(inds: [] this.idxType) where isAssociativeArr(this) {
+      use Reflection;
+      if canResolveMethod(_value, "dsiBulkGet", inds) {
+        return _value.dsiBulkGet(inds);
+      } else {
+        var result: [inds.domain] eltType;
+        forall (r, i) in zip(result, inds) do r = this[i];
+        return result;
+      }
+    }
+
+    /*
+       Set the elements of this array at each of the indices in ``inds`` to
+       the corresponding values in ``vals``. If an index occurs more than
+       once in ``inds``, which of its values is stored is unspecified.
+
+       This method is only available for associative arrays. For
+       distributed associative arrays, it writes all the elements each
+       locale owns at once, rather than one element at a time.
+     */
+    proc bulkSet(inds: [] this.idxType, vals: [] eltType)
+        where isAssociativeArr(this) {
+      if boundsChecking && inds.size != vals.size then
+        halt("bulkSet: inds and vals must have the same size");
+
+      use Reflection;
+      if canResolveMethod(_value, "dsiBulkSet", inds, vals) {
+        _value.dsiBulkSet(inds, vals);
+      } else {
+        forall (i, v) in zip(inds, vals) do this[i] = v;
+      }
+    }
+
     /* Yield the array elements in sorted order. */
     iter sorted(comparator:?t = chpl_defaultComparator()) {
       use Reflection;
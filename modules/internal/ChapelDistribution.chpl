@@ -483,17 +483,15 @@ module ChapelDistribution {
         if isUnique {
           const indsStart = inds.domain.low;
           const indsEnd = inds.domain.high;
-          var lastInd = inds[indsStart];
-          for i in indsStart+1..indsEnd {
-            if inds[i] == lastInd then
-              halt("bulkAdd: There are duplicates, call the function \
-                  with isUnique=false");
-            else lastInd = inds[i];
-          }
+          const hasDups = || reduce [i in indsStart+1..indsEnd]
+                                      inds[i] == inds[i-1];
+          if hasDups then
+            halt("bulkAdd: There are duplicates, call the function \
+                with isUnique=false");
         }
 
         //check OOB
-        for i in inds do boundsCheck(i);
+        forall i in inds do boundsCheck(i);
       }
     }
 
@@ -502,44 +500,86 @@ module ChapelDistribution {
     // indices. If, for some reason it changes, this function and bulkAdds have to
     // be refactored. (I think it is a safe assumption at this point and keeps the
     // function a bit cleaner than some other approach. -Engin)
+    //
+    // Returns the position of each index of the sorted array 'inds' in the
+    // merged storage (-1 if it is a duplicate or already in 'd'), the number
+    // of indices to add, and the positions in 'inds' of the indices to add,
+    // in order.  Each step runs in parallel.
     proc __getActualInsertPts(d, inds, isUnique) {
+      use RangeChunk;
 
-      //find individual insert points
-      //and eliminate duplicates between inds and dom
-      var indivInsertPts: [inds.domain] int;
+      const indsRange = inds.domain.dim(1);
       var actualInsertPts: [inds.domain] int; //where to put in newdom
 
-      //eliminate duplicates --assumes sorted
-      if !isUnique {
-        //make sure lastInd != inds[inds.domain.low]
-        var lastInd = inds[inds.domain.low] + 1;
-        for (i, p) in zip(inds, indivInsertPts)  {
-          if i == lastInd then p = -1;
-          else lastInd = i;
-        }
-      }
-
-      forall (i,p) in zip(inds, indivInsertPts) {
-        if isUnique || p != -1 { //don't do anything if it's duplicate
-          const (found, insertPt) = d.find(i);
-          p = if found then -1 else insertPt; //mark as duplicate
+      //find individual insert points, and eliminate duplicates within inds
+      //(--assumes sorted) and between inds and dom
+      forall (i, p) in zip(indsRange, actualInsertPts) {
+        if !isUnique && i != indsRange.first &&
+           inds[i] == inds[i-indsRange.stride] then
+          p = -1; //mark as duplicate
+        else {
+          const (found, insertPt) = d.find(inds[i]);
+          p = if found then -1 else insertPt;
         }
       }
 
       //shift insert points for bulk addition
       //previous indexes that are added will cause a shift in the next indexes
+      const numTasks = _bulkAddTasks(indsRange.size);
+      var taskStart: [0..#numTasks] int;
+      coforall t in 0..#numTasks {
+        var cnt = 0;
+        for i in chunk(indsRange, numTasks, t) do
+          if actualInsertPts[i] != -1 then cnt += 1;
+        taskStart[t] = cnt;
+      }
+
       var actualAddCnt = 0;
+      for t in 0..#numTasks {
+        const cnt = taskStart[t];
+        taskStart[t] = actualAddCnt;
+        actualAddCnt += cnt;
+      }
 
-      //NOTE: this can also be done with scan
-      for (ip, ap) in zip(indivInsertPts, actualInsertPts) {
-        if ip != -1 {
-          ap = ip + actualAddCnt;
-          actualAddCnt += 1;
+      var addedPos: [0..#actualAddCnt] int;
+      coforall t in 0..#numTasks {
+        var k = taskStart[t];
+        for i in chunk(indsRange, numTasks, t) {
+          if actualInsertPts[i] != -1 {
+            actualInsertPts[i] += k;
+            addedPos[k] = i;
+            k += 1;
+          }
         }
-        else ap = ip;
       }
 
-      return (actualInsertPts, actualAddCnt);
+      return (actualInsertPts, actualAddCnt, addedPos);
+    }
+
+    // Returns where each of the first 'oldnnz' stored indices moves once the
+    // indices found by __getActualInsertPts are added: up by the number of
+    // added indices that go before it.
+    proc __getShiftMap(actualInsertPts, addedPos, oldnnz) {
+      var shiftMap: [{1..oldnnz}] int;
+      const numAdded = addedPos.size;
+      forall i in 1..oldnnz {
+        // the k'th added index goes before old index
+        // actualInsertPts[addedPos[k]]-k, which increases with k
+        var lo = 0, hi = numAdded;
+        while lo < hi {
+          const mid = (lo + hi) / 2;
+          if actualInsertPts[addedPos[mid]] - mid <= i then lo = mid + 1;
+          else hi = mid;
+        }
+        shiftMap[i] = i + lo;
+      }
+      return shiftMap;
+    }
+
+    inline proc _bulkAddTasks(n: int) {
+      const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                       else dataParTasksPerLocale;
+      return max(1, min(numTasks, n));
     }
 
     proc dsiClear(){
@@ -661,6 +701,8 @@ module ChapelDistribution {
 
     proc dsiStaticFastFollowCheck(type leadType) param return false;
 
+    proc dsiStaticAutoLocalCheck(type iterandType) param return false;
+
     proc dsiGetBaseDom(): unmanaged BaseDom {
       halt("internal error: dsiGetBaseDom is not implemented");
       return nil;
@@ -887,22 +929,11 @@ module ChapelDistribution {
     // oldnnz is the number of elements in the array. As the function is called
     // at the end of bulkAdd, it is almost certain that oldnnz!=data.size
     override proc sparseBulkShiftArray(shiftMap, oldnnz){
-      var newIdx: int;
-      var prevNewIdx = 1;
-
-      // fill all new indices i s.t. i > indices[oldnnz]
-      forall i in shiftMap.domain.high+1..dom.nnzDom.high do data[i] = irv;
+      // copy the old values out so they can be moved in parallel
+      const oldData: [1..oldnnz] eltType = data[1..oldnnz];
 
-      for (i, _newIdx) in zip(1..oldnnz by -1, shiftMap.domain.dim(1) by -1) {
-        newIdx = shiftMap[_newIdx];
-        data[newIdx] = data[i];
-
-        //fill IRV up to previously added nnz
-        for emptyIndex in newIdx+1..prevNewIdx-1 do data[emptyIndex] = irv;
-        prevNewIdx = newIdx;
-      }
-      //fill the initial added space with IRV
-      for i in 1..prevNewIdx-1 do data[i] = irv;
+      forall i in dom.nnzDom do data[i] = irv;
+      forall i in 1..oldnnz do data[shiftMap[i]] = oldData[i];
     }
 
     // shift data array after single index addition. Fills the new index with irv
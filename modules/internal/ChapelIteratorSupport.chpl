@@ -554,6 +554,29 @@ module ChapelIteratorSupport {
       return chpl__dynamicFastFollowCheckZip(x(dim), lead) && chpl__dynamicFastFollowCheckZip(x, lead, dim+1);
   }
 
+  //
+  // return true if accesses to 'x' indexed by the index of a forall over
+  // 'iterand' can use localAccess() (see autoLocalAccess.cpp)
+  //
+  proc chpl__staticAutoLocalCheck(x, iterand) param {
+    return false;
+  }
+
+  proc chpl__staticAutoLocalCheck(x: [], iterand: domain) param {
+    return x._value.dsiStaticAutoLocalCheck(iterand._value.type);
+  }
+
+  proc chpl__dynamicAutoLocalCheck(x, iterand) {
+    return false;
+  }
+
+  proc chpl__dynamicAutoLocalCheck(x: [], iterand: domain) {
+    if chpl__staticAutoLocalCheck(x, iterand) then
+      return x._value.dsiDynamicFastFollowCheck(iterand);
+    else
+      return false;
+  }
+
   pragma "no implicit copy"
   pragma "fn returns iterator"
   inline proc _toFollower(iterator: _iteratorClass, leaderIndex)
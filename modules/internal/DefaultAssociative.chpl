@@ -371,6 +371,46 @@ module DefaultAssociative {
       return retval;
     }
   
+    // Adds the indices in 'inds', growing the table once for all of them
+    // instead of rehashing repeatedly as they are added, and hashing them
+    // in parallel.  The flags match those of the sparse bulkAdd; they do
+    // not change how indices are added to an associative domain.
+    proc dsiBulkAdd(inds: [] idxType, dataSorted=false, isUnique=false,
+                    preserveInds=true) {
+      var added = 0;
+      on this {
+        const needed = numEntries.read() + inds.size;
+        if (needed+1)*2 > tableSize then
+          dsiRequestCapacity(needed);
+
+        var hashes: [inds.domain] uint;
+        forall (h, idx) in zip(hashes, inds) do
+          h = chpl__defaultHashWrapper(idx):uint;
+
+        if parSafe then lockTable();
+        for (idx, baseSlot) in zip(inds, hashes) {
+          if (numEntries.read()+1)*2 > tableSize then
+            _resize(grow=true);
+          // probe the same sequence of slots as _lookForSlots
+          const n = tableSize:uint;
+          for probe in 0..tableSize/2 {
+            const slotNum = ((baseSlot + (probe:uint)**2)%n):int;
+            const slotStatus = table[slotNum].status;
+            if slotStatus == chpl__hash_status.empty ||
+               slotStatus == chpl__hash_status.deleted {
+              (_, _) = _add(idx, slotNum);
+              added += 1;
+              break;
+            } else if table[slotNum].idx == idx {
+              break;
+            }
+          }
+        }
+        if parSafe then unlockTable();
+      }
+      return added;
+    }
+
     proc findPrimeSizeIndex(numKeys:int) {
       //Find the first suitable prime
       var threshold = (numKeys + 1) * 2;
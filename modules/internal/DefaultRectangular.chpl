@@ -23,9 +23,12 @@ module DefaultRectangular {
   config const dataParTasksPerLocale = 0;
   config const dataParIgnoreRunningTasks = false;
   config const dataParMinGranularity: int = 1;
+  // minimum number of bytes copied per task by a local bulk transfer
+  config const dataParMinTransferBytes: int = 1024 * 1024;
 
   if dataParTasksPerLocale<0 then halt("dataParTasksPerLocale must be >= 0");
   if dataParMinGranularity<=0 then halt("dataParMinGranularity must be > 0");
+  if dataParMinTransferBytes<0 then halt("dataParMinTransferBytes must be >= 0");
 
   use DSIUtil, ChapelArray;
   use ExternalArray;
@@ -1060,7 +1063,7 @@ module DefaultRectangular {
     override proc dsiDestroyArr() {
       if (externArr) {
         if (!_borrowed) {
-          chpl_call_free_func(externFreeFunc, c_ptrTo(data));
+          chpl_call_free_func(externFreeFunc, data:c_void_ptr);
         }
       } else {
         if dom.dsiNumIndices > 0 || dataAllocRange.length > 0 {
@@ -1898,6 +1901,20 @@ module DefaultRectangular {
     // compilation does not work right now.  The calls to chpl_comm_get
     // and chpl_comm_put should be changed once that is fixed.
     if Adata.locale.id==here.id {
+      // Split large copies between two distinct local arrays across
+      // tasks. A single memmove() cannot saturate the memory bandwidth.
+      if Bdata.locale.id==here.id && A.data != B.data {
+        const numChunks = _computeTransferChunks(len * c_sizeof(A.eltType),
+                                                 len);
+        if numChunks > 1 {
+          if debugDefaultDistBulkTransfer then
+            chpl_debug_writeln("\tparallel local copy using ", numChunks,
+                               " tasks");
+          _parallelLocalTransfer(Adata, Bdata, len, numChunks);
+          return;
+        }
+      }
+
       if debugDefaultDistBulkTransfer then
         chpl_debug_writeln("\tlocal get() from ", B.locale.id);
       __primitive("chpl_comm_array_get", Adata[0], Bdata.locale.id, Bdata[0], len);
@@ -1912,6 +1929,31 @@ module DefaultRectangular {
     }
   }
 
+  //
+  // Return the number of tasks to use for a local copy of 'numBytes' bytes
+  // that can be split into at most 'maxChunks' pieces.
+  //
+  private proc _computeTransferChunks(numBytes: size_t, maxChunks) : int {
+    if __primitive("task_get_serial") then return 1;
+
+    const numTasks = if dataParTasksPerLocale==0 then here.maxTaskPar
+                     else dataParTasksPerLocale;
+    const numChunks = _computeNumChunks(numTasks, dataParIgnoreRunningTasks,
+                                        dataParMinTransferBytes,
+                                        numBytes:int);
+
+    return max(1, min(numChunks, maxChunks:int));
+  }
+
+  private proc _parallelLocalTransfer(Adata, Bdata, len: size_t, numChunks) {
+    coforall chunk in 1..numChunks {
+      const (lo, hi) = _computeChunkStartEnd(len, numChunks:size_t,
+                                             chunk:size_t);
+      __primitive("chpl_comm_array_get", Adata[lo-1], here.id, Bdata[lo-1],
+                  hi-lo+1);
+    }
+  }
+
   /*
   For more details, see: http://upc.lbl.gov/publications/upc_memcpy.pdf
     'Proposal for Extending the UPC Memory Copy Library Functions and
@@ -2134,6 +2176,26 @@ module DefaultRectangular {
     if dest.locale.id == here.id {
       const srclocale = src.locale.id : int(32);
 
+      // As in _simpleTransferHelper(), split large local copies between
+      // tasks, here along the outermost stride level.
+      if srclocale == here.id && stridelevels > 0 && dest != src {
+        var numBytes = c_sizeof(A.eltType);
+        for c in count do numBytes *= c; // serial to avoid task creation overhead
+
+        const numChunks = _computeTransferChunks(numBytes,
+                                                 count[stridelevels+1]);
+        if numChunks > 1 {
+          if debugBulkTransfer {
+            chpl_debug_writeln("BulkTransferStride: parallel local copy using ",
+                               numChunks, " tasks");
+          }
+
+          _parallelStridedTransfer(dest, AO, dstStride, src, BO, srcStride,
+                                   count, stridelevels, numChunks);
+          return;
+        }
+      }
+
       if debugBulkTransfer {
         chpl_debug_writeln("BulkTransferStride: On LHS - GET from ", srclocale);
       }
@@ -2171,6 +2233,43 @@ module DefaultRectangular {
     }
   }
 
+  //
+  // Each task copies a contiguous range of the outermost stride level, so
+  // only that level's count and the starting offsets differ between tasks.
+  //
+  private proc _parallelStridedTransfer(dest, AO, dstStride, src, BO, srcStride,
+                                        count, stridelevels:int(32),
+                                        numChunks) {
+    const outer          = count[stridelevels+1];
+    const outerDstStride = dstStride[stridelevels];
+    const outerSrcStride = srcStride[stridelevels];
+
+    const dststr = dstStride._value.data;
+    const srcstr = srcStride._value.data;
+
+    coforall chunk in 1..numChunks {
+      const (lo, hi) = _computeChunkStartEnd(outer, numChunks:size_t,
+                                             chunk:size_t);
+
+      var myCount : [count.domain] size_t;
+      for i in count.domain do myCount[i] = count[i];
+      myCount[stridelevels+1] = hi-lo+1;
+
+      const cnt  = myCount._value.data;
+      const dOff = AO + ((lo-1) * outerDstStride):AO.type;
+      const sOff = BO + ((lo-1) * outerSrcStride):BO.type;
+
+      __primitive("chpl_comm_get_strd",
+                  dest[dOff],
+                  dststr[0],
+                  here.id:int(32),
+                  src[sOff],
+                  srcstr[0],
+                  cnt[0],
+                  stridelevels);
+    }
+  }
+
   proc DefaultRectangularArr.isDefaultRectangular() param return true;
   proc type DefaultRectangularArr.isDefaultRectangular() param return true;
 
@@ -245,78 +245,27 @@ module DefaultSparse {
 
       bulkAdd_prepareInds(inds, dataSorted, isUnique, Sort.defaultComparator);
 
-      if nnz == 0 {
-
-        const dupCount = if isUnique then 0 else _countDuplicates(inds);
-
-        nnz += inds.size-dupCount;
-        _bulkGrow();
-
-        var indIdx = indices.domain.low;
-        var prevIdx = parentDom.low - 1;
-
-        if isUnique {
-          indices[indices.domain.low..#inds.size]=inds;
-          return inds.size;
-        }
-        else {
-          for i in inds {
-            if i == prevIdx then continue;
-            else prevIdx = i;
-
-            indices[indIdx] = i;
-            indIdx += 1;
-          }
-          return indIdx-1;
-        }
-      }
-
-      const (actualInsertPts, actualAddCnt) =
+      const (actualInsertPts, actualAddCnt, addedPos) =
         __getActualInsertPts(this, inds, isUnique);
 
+      if actualAddCnt == 0 then return 0;
+
       const oldnnz = nnz;
       nnz += actualAddCnt;
 
       //grow nnzDom if necessary
       _bulkGrow();
 
-      //linearly fill the new colIdx from backwards
-      var newIndIdx = indsDom.high; //index into new indices
-      var oldIndIdx = oldnnz; //index into old indices
-      var newLoc = actualInsertPts[newIndIdx]; //its position-to-be in new dom
-      while newLoc == -1 {
-        newIndIdx -= 1;
-        if newIndIdx == indsDom.low-1 then break; //there were duplicates -- now done
-        newLoc = actualInsertPts[newIndIdx];
-      }
-
-      var arrShiftMap: [{1..oldnnz}] int; //to map where data goes
+      const arrShiftMap = __getShiftMap(actualInsertPts, addedPos, oldnnz);
 
-      for i in 1..nnz by -1 {
-        if oldIndIdx >= 1 && i > newLoc {
-          //shift from old values
-          indices[i] = indices[oldIndIdx];
-          arrShiftMap[oldIndIdx] = i;
-          oldIndIdx -= 1;
-        }
-        else if newIndIdx >= indsDom.low && i == newLoc {
-          //put the new guy in
-          indices[i] = inds[newIndIdx];
-          newIndIdx -= 1;
-          if newIndIdx >= indsDom.low then 
-            newLoc = actualInsertPts[newIndIdx];
-          else
-            newLoc = -2; //finished new set
-          while newLoc == -1 {
-            newIndIdx -= 1;
-            if newIndIdx == indsDom.low-1 then break; //there were duplicates -- now done
-            newLoc = actualInsertPts[newIndIdx];
-          }
-        }
-        else halt("Something went wrong");
+      //move the old indices up to make room, then fill in the new ones
+      if oldnnz > 0 {
+        const oldIndices: [1..oldnnz] index(rank, idxType) = indices[1..oldnnz];
+        forall i in 1..oldnnz do indices[arrShiftMap[i]] = oldIndices[i];
       }
+      forall p in addedPos do indices[actualInsertPts[p]] = inds[p];
 
-      for a in _arrs do 
+      for a in _arrs do
         a.sparseBulkShiftArray(arrShiftMap, oldnnz);
 
       return actualAddCnt;
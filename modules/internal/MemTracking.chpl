@@ -89,27 +89,24 @@ module MemTracking
     if (here.id != 0) {
       if memLeaksByDesc.length != 0 {
         var local_memLeaksByDesc = memLeaksByDesc;
-        // Intentionally leak the string to persist the underlying buffer
-        local_memLeaksByDesc.isowned = false;
-        ret_memLeaksByDesc = local_memLeaksByDesc.c_str();
+        // Intentionally leak the buffer so that it persists
+        ret_memLeaksByDesc = local_memLeaksByDesc._releaseBuffer():c_string;
       } else {
         ret_memLeaksByDesc = nil;
       }
 
       if memLog.length != 0 {
         var local_memLog = memLog;
-        // Intentionally leak the string to persist the underlying buffer
-        local_memLog.isowned = false;
-        ret_memLog = local_memLog.c_str();
+        // Intentionally leak the buffer so that it persists
+        ret_memLog = local_memLog._releaseBuffer():c_string;
       } else {
         ret_memLog = nil;
       }
 
       if memLeaksLog.length != 0 {
         var local_memLeaksLog = memLeaksLog;
-        // Intentionally leak the string to persist the underlying buffer
-        local_memLeaksLog.isowned = false;
-        ret_memLeaksLog = local_memLeaksLog.c_str();
+        // Intentionally leak the buffer so that it persists
+        ret_memLeaksLog = local_memLeaksLog._releaseBuffer():c_string;
       } else {
         ret_memLeaksLog = nil;
       }
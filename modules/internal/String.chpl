@@ -22,6 +22,12 @@
  *
  * - An empty string is represented by len == 0 and buff == nil.
  *
+ * - A string shorter than CHPL_SHORT_STRING_SIZE bytes is normally stored in
+ *   shortData, within the record itself, and has buff == nil and len != 0.
+ *   Its bytes live wherever the record does, which is always the string's
+ *   locale_id, so they must be accessed through _buffer() on that locale or
+ *   read by value from a remote record (see copyStringBytes).
+ *
  * - It is assumed the bufferType is a local-only type, so we never
  *   make a remote copy of one passed in by the user, though remote
  *   copies are made of internal bufferType variables.
@@ -179,6 +185,18 @@ module String {
   pragma "fn synchronization free"
   private extern proc qio_nbytes_char(chr:int(32)):c_int;
 
+  pragma "fn synchronization free"
+  private extern proc chpl_bytes_find(haystack:bufferType, hlen:int,
+                                      needle:bufferType, nlen:int):int;
+  pragma "fn synchronization free"
+  private extern proc chpl_bytes_rfind(haystack:bufferType, hlen:int,
+                                       needle:bufferType, nlen:int):int;
+  pragma "fn synchronization free"
+  private extern proc chpl_bytes_count(haystack:bufferType, hlen:int,
+                                       needle:bufferType, nlen:int):int;
+  pragma "fn synchronization free"
+  private extern proc chpl_bytes_hash(buf:bufferType, len:int):uint;
+
   pragma "no doc"
   extern const CHPL_SHORT_STRING_SIZE : c_int;
 
@@ -206,6 +224,21 @@ module String {
       return dest;
   }
 
+  // Copies 'len' bytes starting at byte 'offset' (0-based) of 's' to 'dest',
+  // which must be local.  's' may be remote.
+  private inline proc copyStringBytes(dest: bufferType, const ref s: string,
+                                      offset: int, len: int) {
+    if s._isShort() {
+      // The bytes are part of the record, so read them by value
+      const data = s.shortData;
+      c_memcpy(dest, chpl__getInPlaceBufferData(data) + offset, len);
+    } else if _local || s.locale_id == chpl_nodeID {
+      c_memcpy(dest, s.buff + offset, len);
+    } else {
+      chpl_string_comm_get(dest, s.locale_id, s.buff + offset, len);
+    }
+  }
+
   private config param debugStrings = false;
 
   pragma "no doc"
@@ -306,6 +339,9 @@ module String {
     // We use chpl_nodeID as a shortcut to get at here.id without actually constructing
     // a locale object. Used when determining if we should make a remote transfer.
     var locale_id = chpl_nodeID; // : chpl_nodeID_t
+    pragma "no doc"
+    // Holds the bytes of short strings, see _isShort()
+    var shortData: chpl__inPlaceBuffer;
 
     pragma "no doc"
     proc init() {
@@ -319,6 +355,13 @@ module String {
       string may appear in ``s``. It is the responsibility of the user to
       ensure that the underlying buffer is not freed while being used as part
       of a shallow copy.
+
+      .. note::
+
+        Short strings (currently those shorter than 16 bytes) are stored
+        within the string record itself, so they are always fully copied,
+        even if ``isowned`` is ``false``. Modifications to the new string
+        do not appear in ``s`` in that case.
      */
     proc init(s: string, isowned: bool = true) {
       const sRemote = _local == false && s.locale_id != chpl_nodeID;
@@ -328,7 +371,14 @@ module String {
       // Don't need to do anything if s is an empty string
       if sLen != 0 {
         this.len = sLen;
-        if !_local && sRemote {
+        if s._isShort() ||
+           (sLen < CHPL_SHORT_STRING_SIZE && (this.isowned || sRemote)) {
+          // Short strings are always copied, into this record
+          this.isowned = true;
+          const buf = chpl__getInPlaceBufferDataForWrite(this.shortData);
+          copyStringBytes(buf, s, 0, sLen);
+          buf[sLen] = 0;
+        } else if !_local && sRemote {
           // ignore supplied value of isowned for remote strings so we don't leak
           this.isowned = true;
           this.buff = copyRemoteBuffer(s.locale_id, s.buff, sLen);
@@ -407,7 +457,9 @@ module String {
     pragma "no doc"
     proc chpl__serialize() {
       var data : chpl__inPlaceBuffer;
-      if len <= CHPL_SHORT_STRING_SIZE {
+      if _isShort() {
+        data = shortData;
+      } else if len < CHPL_SHORT_STRING_SIZE {
         chpl_string_comm_get(chpl__getInPlaceBufferDataForWrite(data), locale_id, buff, len);
       }
       return new __serializeHelper(len, buff, _size, locale_id, data);
@@ -415,8 +467,12 @@ module String {
 
     pragma "no doc"
     proc type chpl__deserialize(data) {
-      if data.locale_id != chpl_nodeID {
-        if data.len <= CHPL_SHORT_STRING_SIZE {
+      if data.buff == nil && data.len != 0 {
+        // A short string, whose bytes came along in shortData
+        return new string(chpl__getInPlaceBufferData(data.shortData), data.len,
+                          data.size, isowned=true, needToCopy=true);
+      } else if data.locale_id != chpl_nodeID {
+        if data.len < CHPL_SHORT_STRING_SIZE {
           return new string(chpl__getInPlaceBufferData(data.shortData), data.len,
                             data.size, isowned=true, needToCopy=true);
         } else {
@@ -429,6 +485,65 @@ module String {
       }
     }
 
+    // Whether the bytes of this string are stored in shortData
+    pragma "no doc"
+    inline proc _isShort() : bool {
+      return buff == nil && len != 0;
+    }
+
+    // Returns a pointer to the bytes of this string.  This is assumed to be
+    // called from this.locale, and the pointer is only valid until the
+    // string is modified or moved.
+    pragma "no doc"
+    inline proc _buffer() : bufferType {
+      if _isShort() then
+        return chpl__getInPlaceBufferData(shortData);
+      return buff;
+    }
+
+    // Like _buffer(), for a string that owns its bytes and is about to
+    // modify them in place.
+    pragma "no doc"
+    inline proc ref _bufferForWrite() : bufferType {
+      if _isShort() then
+        return chpl__getInPlaceBufferDataForWrite(shortData);
+      return buff;
+    }
+
+    // Sets up a newly created, empty string to hold up to 'maxLen' bytes and
+    // returns the buffer to write them to.  The caller sets 'len' and stores
+    // the terminating NUL.
+    pragma "no doc"
+    proc ref _allocBuffer(maxLen: int) : bufferType {
+      this.isowned = true;
+      if maxLen < CHPL_SHORT_STRING_SIZE then
+        return chpl__getInPlaceBufferDataForWrite(this.shortData);
+      const allocSize = chpl_here_good_alloc_size(maxLen+1);
+      this._size = allocSize;
+      this.buff = chpl_here_alloc(allocSize,
+                                  offset_STR_COPY_DATA): bufferType;
+      return this.buff;
+    }
+
+    // Returns a NUL-terminated copy of the bytes of this string that the
+    // caller is responsible for freeing, leaving this string empty.  Reuses
+    // the string's own buffer when it can.  This is assumed to be called
+    // from this.locale.
+    pragma "no doc"
+    proc ref _releaseBuffer() : bufferType {
+      var ret = this.buff;
+      if _isShort() || !this.isowned {
+        ret = chpl_here_alloc(this.len+1, offset_STR_COPY_DATA): bufferType;
+        c_memcpy(ret, this._buffer(), this.len);
+        ret[this.len] = 0;
+      }
+      this.buff = nil;
+      this.len = 0;
+      this._size = 0;
+      this.isowned = true;
+      return ret;
+    }
+
     // This is assumed to be called from this.locale
     pragma "no doc"
     proc ref reinitString(buf: bufferType, s_len: int, size: int,
@@ -438,11 +553,25 @@ module String {
       // If the this.buff is longer than buf, then reuse the buffer if we are
       // allowed to (this.isowned == true)
       if s_len != 0 {
-        if needToCopy {
+        if s_len < CHPL_SHORT_STRING_SIZE && (needToCopy || this.isowned) {
+          // Keep short strings in shortData.  'buf' may point into our own
+          // buffer, so copy it before freeing anything.  If we were given
+          // ownership of 'buf', we are done with it once it is copied.
+          const dst = chpl__getInPlaceBufferDataForWrite(this.shortData);
+          c_memmove(dst, buf, s_len);
+          dst[s_len] = 0;
+          if this.isowned && this.buff != nil then
+            chpl_here_free(this.buff);
+          if !needToCopy then
+            chpl_here_free(buf);
+          this.buff = nil;
+          this._size = 0;
+          this.isowned = true;
+        } else if needToCopy {
           if !this.isowned || s_len+1 > this._size {
             // If the new string is too big for our current buffer or we dont
             // own our current buffer then we need a new one.
-            if this.isowned && !this.isEmpty() then
+            if this.isowned && this.buff != nil then
               chpl_here_free(this.buff);
             // TODO: should I just allocate 'size' bytes?
             const allocSize = chpl_here_good_alloc_size(s_len+1);
@@ -455,7 +584,7 @@ module String {
           c_memmove(this.buff, buf, s_len);
           this.buff[s_len] = 0;
         } else {
-          if this.isowned && !this.isEmpty() then
+          if this.isowned && this.buff != nil then
             chpl_here_free(this.buff);
           this.buff = buf;
           this._size = size;
@@ -463,7 +592,7 @@ module String {
       } else {
         // If s_len is 0, 'buf' may still have been allocated. Regardless, we
         // need to free the old buffer if 'this' is isowned.
-        if this.isowned && !this.isEmpty() then chpl_here_free(this.buff);
+        if this.isowned && this.buff != nil then chpl_here_free(this.buff);
         this._size = 0;
 
         // If we need to copy, we can just set 'buff' to nil. Otherwise the
@@ -513,6 +642,7 @@ module String {
 
        :returns: A shallow copy if the :record:`string` is already on the
                  current locale, otherwise a deep copy is performed.
+                 Short strings are always copied (see :proc:`string.init`).
     */
     inline proc localize() : string {
       if _local || this.locale_id == chpl_nodeID {
@@ -546,6 +676,16 @@ module String {
           A `c_string` that points to the underlying buffer used by this
           :record:`string`. The returned `c_string` is only valid when used
           on the same locale as the string.
+
+      .. warning::
+
+          The bytes of a short string (currently one shorter than 16 bytes)
+          are stored within the :record:`string` record itself, so for such a
+          string the `c_string` points into the record. It becomes invalid
+          when the record is destroyed or moved, for example when a
+          temporary string goes out of scope or the string is returned from
+          a procedure, even if the string's value has not changed. Copy the
+          bytes out if they need to outlive the record.
      */
     inline proc c_str(): c_string {
       inline proc _cast(type t:c_string, x:bufferType) {
@@ -555,7 +695,7 @@ module String {
       if _local == false && this.locale_id != chpl_nodeID then
         halt("Cannot call .c_str() on a remote string");
 
-      return this.buff:c_string;
+      return this._buffer():c_string;
     }
 
     pragma "no doc"
@@ -587,8 +727,7 @@ module String {
      */
     iter these() : string {
       for i in 1..this.len {
-        // This is pretty painful from a performance perspective right now,
-        // allocates w/ every yield
+        // Each character is a short string, so this does not allocate
         yield this[i];
       }
     }
@@ -600,7 +739,7 @@ module String {
       var localThis: string = this.localize();
 
       for i in 0..#localThis.len {
-        yield localThis.buff[i];
+        yield localThis._buffer()[i];
       }
     }
 
@@ -614,7 +753,7 @@ module String {
       while i < localThis.len {
         var cp: int(32);
         var nbytes: c_int;
-        var multibytes = (localThis.buff + i): c_string;
+        var multibytes = (localThis._buffer() + i): c_string;
         var maxbytes = (localThis.len - i): ssize_t;
         qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
         yield cp;
@@ -644,7 +783,7 @@ module String {
       while i < localThis.len {
         var cp: int(32);
         var nbytes: c_int;
-        var multibytes = (localThis.buff + i): c_string;
+        var multibytes = (localThis._buffer() + i): c_string;
         var maxbytes = (localThis.len - i): ssize_t;
         qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
         if i + 1 >= start then
@@ -661,7 +800,7 @@ module String {
 
       if boundsChecking && (i <= 0 || i > localThis.len)
         then halt("index out of bounds of string: ", i);
-      return localThis.buff[i - 1];
+      return localThis._buffer()[i - 1];
     }
 
     /*
@@ -698,27 +837,23 @@ module String {
       var maxbytes = (this.len - (i - 1)): ssize_t;
       if maxbytes < 0 || maxbytes > 4 then
         maxbytes = 4;
-      const newSize = chpl_here_good_alloc_size(maxbytes + 1);
-      ret._size = max(chpl_string_min_alloc_size, newSize);
-      ret.buff = chpl_here_alloc(ret._size,
-                                offset_STR_COPY_DATA): bufferType;
-      ret.isowned = true;
+      const buff = ret._allocBuffer(maxbytes);
 
       const remoteThis = _local == false && this.locale_id != chpl_nodeID;
       var multibytes: bufferType;
       if remoteThis {
-        chpl_string_comm_get(ret.buff, this.locale_id, this.buff + i - 1, maxbytes);
-        multibytes = ret.buff;
+        copyStringBytes(buff, this, i - 1, maxbytes);
+        multibytes = buff;
       } else {
-        multibytes = this.buff + i - 1;
+        multibytes = this._buffer() + i - 1;
       }
       var cp: int(32);
       var nbytes: c_int;
       qio_decode_char_buf(cp, nbytes, multibytes:c_string, maxbytes);
       if !remoteThis {
-        c_memcpy(ret.buff, multibytes, nbytes);
+        c_memcpy(buff, multibytes, nbytes);
       }
-      ret.buff[nbytes] = 0;
+      buff[nbytes] = 0;
       ret.len = nbytes;
 
       return ret;
@@ -821,33 +956,25 @@ module String {
         // TODO: I can't just return "" (ret var gets freed for some reason)
         ret = "";
       } else {
-        ret.len = r2.size:int;
-        const newSize = chpl_here_good_alloc_size(ret.len+1);
-        ret._size = max(chpl_string_min_alloc_size, newSize);
-        // FIXME: I was dumb here, just copy the correct region over in
-        // multi-locale and use that as the string buffer. No need to copy stuff
-        // about after pulling it across.
-        ret.buff = chpl_here_alloc(ret._size,
-                                  offset_STR_COPY_DATA): bufferType;
+        const newLen = r2.size:int;
+        // Has perf impact and our LICM can't hoist :(
+        const buff = ret._allocBuffer(newLen);
 
-        var thisBuff: bufferType;
-        const remoteThis = _local == false && this.locale_id != chpl_nodeID;
-        if remoteThis {
-          // TODO: Could do an optimization here and only pull down the data
-          // between r2.low and r2.high. Indexing for the copy below gets a bit
-          // more complex when that is performed though.
-          thisBuff = copyRemoteBuffer(this.locale_id, this.buff, this.len);
-        } else {
-          thisBuff = this.buff;
-        }
+        // TODO: Could do an optimization here and only pull down the data
+        // between r2.low and r2.high when this is remote. Indexing for the
+        // copy below gets a bit more complex when that is performed though.
+        const localThis: string = this.localize();
+        const thisBuff = localThis._buffer();
 
-        var buff = ret.buff; // Has perf impact and our LICM can't hoist :(
-        for (r2_i, i) in zip(r2, 0..) {
-          buff[i] = thisBuff[r2_i-1];
+        if !r2.stridable {
+          c_memcpy(buff, thisBuff + r2.low:int - 1, newLen);
+        } else {
+          for (r2_i, i) in zip(r2, 0..) {
+            buff[i] = thisBuff[r2_i-1];
+          }
         }
-        buff[ret.len] = 0;
-
-        if remoteThis then chpl_here_free(thisBuff);
+        buff[newLen] = 0;
+        ret.len = newLen;
       }
 
       return ret;
@@ -908,13 +1035,13 @@ module String {
 
           const needleR = 0:int..#localNeedle.len;
           if fromLeft {
-            const result = c_memcmp(this.buff, localNeedle.buff,
+            const result = c_memcmp(this._buffer(), localNeedle._buffer(),
                                     localNeedle.len);
             ret = result == 0;
           } else {
             var offset = this.len-localNeedle.len;
-            const result = c_memcmp(this.buff+offset, localNeedle.buff,
-                                    localNeedle.len);
+            const result = c_memcmp(this._buffer()+offset,
+                                    localNeedle._buffer(), localNeedle.len);
             ret = result == 0;
           }
           if ret == true then break;
@@ -945,9 +1072,6 @@ module String {
 
 
     // Helper function that uses a param bool to toggle between count and find
-    //TODO: this could be a much better string search
-    //      (Boyer-Moore-Horspool|any thing other than brute force)
-    //
     pragma "no doc"
     inline proc _search_helper(needle: string, region: range(?),
                                param count: bool, param fromLeft: bool = true) {
@@ -986,27 +1110,47 @@ module String {
           localRet = 0;
           const localNeedle: string = needle.localize();
 
-          // i *is not* an index into anything, it is the order of the element
-          // of view we are searching from.
-          const numPossible = thisLen - nLen + 1;
-          const searchSpace = if fromLeft
-              then 0..#(numPossible)
-              else 0..#(numPossible) by -1;
-          for i in searchSpace {
-            // j *is* the index into the localNeedle's buffer
-            for j in 0..#nLen {
-              const idx = view.orderToIndex(i+j); // 1s based idx
-              if this.buff[idx-1] != localNeedle.buff[j] then break;
-
-              if j == nLen-1 {
-                if count {
-                  localRet += 1;
-                } else { // find
-                  localRet = view.orderToIndex(i);
+          const thisBuff = this._buffer();
+          const needleBuff = localNeedle._buffer();
+
+          if !view.stridable {
+            // The region is a contiguous run of bytes, so the runtime's
+            // search routines can be used directly on the buffer.
+            const start = view.low:int - 1;
+            if count {
+              localRet = chpl_bytes_count(thisBuff + start, thisLen,
+                                          needleBuff, nLen);
+            } else {
+              const pos = if fromLeft
+                then chpl_bytes_find(thisBuff + start, thisLen,
+                                     needleBuff, nLen)
+                else chpl_bytes_rfind(thisBuff + start, thisLen,
+                                      needleBuff, nLen);
+              if pos >= 0 then localRet = start + pos + 1;
+            }
+          } else {
+            // i *is not* an index into anything, it is the order of the
+            // element of view we are searching from.
+            const numPossible = thisLen - nLen + 1;
+            const searchSpace = if fromLeft
+                then 0..#(numPossible)
+                else 0..#(numPossible) by -1;
+            for i in searchSpace {
+              // j *is* the index into the localNeedle's buffer
+              for j in 0..#nLen {
+                const idx = view.orderToIndex(i+j); // 1s based idx
+                if thisBuff[idx-1] != needleBuff[j] then break;
+
+                if j == nLen-1 {
+                  if count {
+                    localRet += 1;
+                  } else { // find
+                    localRet = view.orderToIndex(i);
+                  }
                 }
               }
+              if !count && localRet != 0 then break;
             }
-            if !count && localRet != 0 then break;
           }
         }
         ret = localRet;
@@ -1291,12 +1435,7 @@ module String {
           return '';
 
         var joined: string;
-        joined.len = joinedSize;
-        const allocSize = chpl_here_good_alloc_size(joined.len + 1);
-        joined._size = allocSize;
-        joined.buff = chpl_here_alloc(
-          allocSize,
-          offset_STR_COPY_DATA): bufferType;
+        const joinedBuff = joined._allocBuffer(joinedSize);
 
         var first = true;
         var offset = 0;
@@ -1304,21 +1443,18 @@ module String {
           if first {
             first = false;
           } else if this.len != 0 {
-            c_memcpy(joined.buff + offset, this.buff, this.len);
+            copyStringBytes(joinedBuff + offset, this, 0, this.len);
             offset += this.len;
           }
 
           var sLen = s.len;
           if sLen != 0 {
-            var cpyStart = joined.buff + offset;
-            if _local || s.locale_id == chpl_nodeID {
-              c_memcpy(cpyStart, s.buff, sLen);
-            } else {
-              chpl_string_comm_get(cpyStart, s.locale_id, s.buff, sLen);
-            }
+            copyStringBytes(joinedBuff + offset, s, 0, sLen);
             offset += sLen;
           }
         }
+        joinedBuff[joinedSize] = 0;
+        joined.len = joinedSize;
         return joined;
       }
     }
@@ -1615,18 +1751,19 @@ module String {
       var result: string = this;
       if result.isEmpty() then return result;
 
+      const resultBuff = result._bufferForWrite();
       var i = 0;
       while i < result.len {
         var cp: int(32);
         var nbytes: c_int;
-        var multibytes = (result.buff + i): c_string;
+        var multibytes = (resultBuff + i): c_string;
         var maxbytes = (result.len - i): ssize_t;
         qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
         var lowCodepoint = codepoint_toLower(cp);
         if lowCodepoint != cp {
           // This assumes that the upper and lower case version of a
           // character take the same number of bytes.
-          qio_encode_char_buf(result.buff + i, lowCodepoint);
+          qio_encode_char_buf(resultBuff + i, lowCodepoint);
         }
         i += nbytes;
       }
@@ -1648,18 +1785,19 @@ module String {
       var result: string = this;
       if result.isEmpty() then return result;
 
+      const resultBuff = result._bufferForWrite();
       var i = 0;
       while i < result.len {
         var cp: int(32);
         var nbytes: c_int;
-        var multibytes = (result.buff + i): c_string;
+        var multibytes = (resultBuff + i): c_string;
         var maxbytes = (result.len - i): ssize_t;
         qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
         var upCodepoint = codepoint_toUpper(cp);
         if upCodepoint != cp {
           // This assumes that the upper and lower case version of a
           // character take the same number of bytes.
-          qio_encode_char_buf(result.buff + i, upCodepoint);
+          qio_encode_char_buf(resultBuff + i, upCodepoint);
         }
         i += nbytes;
       }
@@ -1682,13 +1820,14 @@ module String {
       var result: string = this;
       if result.isEmpty() then return result;
 
+      const resultBuff = result._bufferForWrite();
       param UN = 0, LETTER = 1;
       var last = UN;
       var i = 0;
       while i < result.len {
         var cp: int(32);
         var nbytes: c_int;
-        var multibytes = (result.buff + i): c_string;
+        var multibytes = (resultBuff + i): c_string;
         var maxbytes = (result.len - i): ssize_t;
         qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
         if codepoint_isAlpha(cp) {
@@ -1698,14 +1837,14 @@ module String {
             if upCodepoint != cp {
               // This assumes that the upper and lower case version of a
               // character take the same number of bytes.
-              qio_encode_char_buf(result.buff + i, upCodepoint);
+              qio_encode_char_buf(resultBuff + i, upCodepoint);
             }
           } else { // last == LETTER
             var lowCodepoint = codepoint_toLower(cp);
             if lowCodepoint != cp {
               // This assumes that the upper and lower case version of a
               // character take the same number of bytes.
-              qio_encode_char_buf(result.buff + i, lowCodepoint);
+              qio_encode_char_buf(resultBuff + i, lowCodepoint);
             }
           }
         } else {
@@ -1729,14 +1868,15 @@ module String {
 
       var cp: int(32);
       var nbytes: c_int;
-      var multibytes = result.buff: c_string;
+      const resultBuff = result._bufferForWrite();
+      var multibytes = resultBuff: c_string;
       var maxbytes = result.len: ssize_t;
       qio_decode_char_buf(cp, nbytes, multibytes, maxbytes);
       var upCodepoint = codepoint_toUpper(cp);
       if upCodepoint != cp {
         // This assumes that the upper and lower case version of a
         // character take the same number of bytes.
-        qio_encode_char_buf(result.buff, upCodepoint);
+        qio_encode_char_buf(resultBuff, upCodepoint);
       }
       return result;
     }
@@ -1753,13 +1893,18 @@ module String {
   proc =(ref lhs: string, rhs: string) {
     inline proc helpMe(ref lhs: string, rhs: string) {
       if _local || rhs.locale_id == chpl_nodeID {
-        lhs.reinitString(rhs.buff, rhs.len, rhs._size, needToCopy=true);
+        lhs.reinitString(rhs._buffer(), rhs.len, rhs._size, needToCopy=true);
       } else {
         const len = rhs.len; // cache the remote copy of len
-        var remote_buf:bufferType = nil;
-        if len != 0 then
-          remote_buf = copyRemoteBuffer(rhs.locale_id, rhs.buff, len);
-        lhs.reinitString(remote_buf, len, len+1, needToCopy=false);
+        if len < CHPL_SHORT_STRING_SIZE {
+          var data: chpl__inPlaceBuffer;
+          const buf = chpl__getInPlaceBufferDataForWrite(data);
+          copyStringBytes(buf, rhs, 0, len);
+          lhs.reinitString(buf, len, len+1, needToCopy=true);
+        } else {
+          const remote_buf = copyRemoteBuffer(rhs.locale_id, rhs.buff, len);
+          lhs.reinitString(remote_buf, len, len+1, needToCopy=false);
+        }
       }
     }
 
@@ -1803,27 +1948,11 @@ module String {
     if s1len == 0 then return s0;
 
     var ret: string;
+    const buff = ret._allocBuffer(s0len + s1len);
+    copyStringBytes(buff, s0, 0, s0len);
+    copyStringBytes(buff+s0len, s1, 0, s1len);
     ret.len = s0len + s1len;
-    const allocSize = chpl_here_good_alloc_size(ret.len+1);
-    ret._size = allocSize;
-    ret.buff = chpl_here_alloc(allocSize,
-                              offset_STR_COPY_DATA): bufferType;
-    ret.isowned = true;
-
-    const s0remote = s0.locale_id != chpl_nodeID;
-    if s0remote {
-      chpl_string_comm_get(ret.buff, s0.locale_id, s0.buff, s0len);
-    } else {
-      c_memcpy(ret.buff, s0.buff, s0len);
-    }
-
-    const s1remote = s1.locale_id != chpl_nodeID;
-    if s1remote {
-      chpl_string_comm_get(ret.buff+s0len, s1.locale_id, s1.buff, s1len);
-    } else {
-      c_memcpy(ret.buff+s0len, s1.buff, s1len);
-    }
-    ret.buff[ret.len] = 0;
+    buff[ret.len] = 0;
 
     return ret;
   }
@@ -1849,27 +1978,18 @@ module String {
     if sLen == 0 then return "";
 
     var ret: string;
-    ret.len = sLen * n; // TODO: check for overflow
-    const allocSize = chpl_here_good_alloc_size(ret.len+1);
-    ret._size = allocSize;
-    ret.buff = chpl_here_alloc(allocSize,
-                              offset_STR_COPY_DATA): bufferType;
-    ret.isowned = true;
-
-    const sRemote = s.locale_id != chpl_nodeID;
-    if sRemote {
-      chpl_string_comm_get(ret.buff, s.locale_id, s.buff, sLen);
-    } else {
-      c_memcpy(ret.buff, s.buff, sLen);
-    }
+    const newLen = sLen * n; // TODO: check for overflow
+    const buff = ret._allocBuffer(newLen);
+    copyStringBytes(buff, s, 0, sLen);
 
     var iterations = n-1;
     var offset = sLen;
     for i in 1..iterations {
-      c_memcpy(ret.buff+offset, ret.buff, sLen);
+      c_memcpy(buff+offset, buff, sLen);
       offset += sLen;
     }
-    ret.buff[ret.len] = 0;
+    buff[newLen] = 0;
+    ret.len = newLen;
 
     return ret;
   }
@@ -1987,31 +2107,32 @@ module String {
                    chpl_buildLocaleID(lhs.locale_id, c_sublocid_any)) {
       const rhsLen = rhs.len;
       const newLength = lhs.len+rhsLen; //TODO: check for overflow
-      if lhs._size <= newLength {
+      if lhs.buff == nil && newLength < CHPL_SHORT_STRING_SIZE {
+        // lhs is empty or short, and the result still fits in shortData
+      } else if lhs._size <= newLength {
         const newSize = chpl_here_good_alloc_size(
             max(newLength+1, lhs.len*chpl_stringGrowthFactor):int);
 
-        if lhs.isowned {
+        if lhs.isowned && lhs.buff != nil {
           lhs.buff = chpl_here_realloc(lhs.buff, newSize,
                                       offset_STR_COPY_DATA):bufferType;
         } else {
           var newBuff = chpl_here_alloc(newSize,
                                        offset_STR_COPY_DATA):bufferType;
-          c_memcpy(newBuff, lhs.buff, lhs.len);
+          c_memcpy(newBuff, lhs._buffer(), lhs.len);
           lhs.buff = newBuff;
           lhs.isowned = true;
         }
 
         lhs._size = newSize;
       }
-      const rhsRemote = rhs.locale_id != chpl_nodeID;
-      if rhsRemote {
-        chpl_string_comm_get(lhs.buff+lhs.len, rhs.locale_id, rhs.buff, rhsLen);
-      } else {
-        c_memcpy(lhs.buff+lhs.len, rhs.buff, rhsLen);
-      }
+      // Copy before updating lhs.len, since rhs may be lhs
+      const lhsBuff = if lhs.buff == nil
+                      then chpl__getInPlaceBufferDataForWrite(lhs.shortData)
+                      else lhs.buff;
+      copyStringBytes(lhsBuff+lhs.len, rhs, 0, rhsLen);
       lhs.len = newLength;
-      lhs.buff[newLength] = 0;
+      lhsBuff[newLength] = 0;
     }
   }
 
@@ -2034,7 +2155,7 @@ module String {
   private inline proc _strcmp_local(a: string, b:string) : int {
     // Assumes a and b are on same locale and not empty.
     const size = min(a.len, b.len);
-    const result =  c_memcmp(a.buff, b.buff, size);
+    const result =  c_memcmp(a._buffer(), b._buffer(), size);
 
     if (result == 0) {
       // Handle cases where one string is the beginning of the other
@@ -2057,6 +2178,11 @@ module String {
 
   pragma "no doc"
   proc ==(a: string, b: string) : bool {
+    // Strings of different lengths can't be equal, and checking this first
+    // avoids localizing either of them.  Hash table probes that collide
+    // usually stop here.
+    if a.len != b.len then return false;
+
     // At the moment, this commented out section will not work correctly. If a
     // and b are on the same locale, we will go to that locale, but an autoCopy
     // will localize a and b, before they are placed into the on bundle,
@@ -2077,6 +2203,7 @@ module String {
 
   pragma "no doc"
   inline proc !=(a: string, b: string) : bool {
+    if a.len != b.len then return true;
     return _strcmp(a, b) != 0;
   }
 
@@ -2172,10 +2299,10 @@ module String {
 
     if _local || a.locale_id == chpl_nodeID {
       // the string must be local so we can index into buff
-      return a.buff[0];
+      return a._buffer()[0];
     } else {
       // a[1] grabs the first character as a string (making it local)
-      return a[1].buff[0];
+      return a[1]._buffer()[0];
     }
   }
 
@@ -2183,10 +2310,11 @@ module String {
      :returns: A string with the single character with the ASCII value `i`.
   */
   inline proc asciiToString(i: uint(8)) {
-    var buffer = chpl_here_alloc(2, offset_STR_COPY_DATA): bufferType;
+    var s: string;
+    const buffer = s._allocBuffer(1);
     buffer[0] = i;
     buffer[1] = 0;
-    var s = new string(buffer, 1, 2, isowned=true, needToCopy=false);
+    s.len = 1;
     return s;
   }
 
@@ -2196,12 +2324,11 @@ module String {
   */
   inline proc codepointToString(i: int(32)) {
     const mblength = qio_nbytes_char(i): int;
-    const mbsize = max(chpl_string_min_alloc_size,
-                       chpl_here_good_alloc_size(mblength + 1));
-    var buffer = chpl_here_alloc(mbsize, offset_STR_COPY_DATA): bufferType;
+    var s: string;
+    const buffer = s._allocBuffer(mblength);
     qio_encode_char_buf(buffer, i);
     buffer[mblength] = 0;
-    var s = new string(buffer, mblength, mbsize, isowned=true, needToCopy=false);
+    s.len = mblength;
     return s;
   }
 
@@ -2226,14 +2353,7 @@ module String {
   // Cast from c_string to string
   pragma "no doc"
   proc _cast(type t, cs: c_string) where t == string {
-    var ret: string;
-    ret.len = cs.length;
-    ret._size = ret.len+1;
-    ret.buff = if ret.len > 0
-      then __primitive("string_copy", cs): bufferType
-      else nil;
-    ret.isowned = true;
-
+    var ret = new string(cs, isowned=true, needToCopy=true);
     return ret;
   }
 
@@ -2257,17 +2377,18 @@ module String {
 
   pragma "no doc"
   inline proc chpl__defaultHash(x : string): uint {
-    var hash: int(64);
-    on __primitive("chpl_on_locale_num",
-                   chpl_buildLocaleID(x.locale_id, c_sublocid_any)) {
-      // Use djb2 (Dan Bernstein in comp.lang.c), XOR version
-      var locHash: int(64) = 5381;
-      for c in 0..#(x.length) {
-        locHash = ((locHash << 5) + locHash) ^ x.buff[c];
+    // The runtime hashes 8 bytes at a time.  Only go to the string's home
+    // locale when it is remote, which is rare for associative domain keys.
+    var hash: uint;
+    if x.locale_id == chpl_nodeID {
+      hash = chpl_bytes_hash(x._buffer(), x.len);
+    } else {
+      on __primitive("chpl_on_locale_num",
+                     chpl_buildLocaleID(x.locale_id, c_sublocid_any)) {
+        hash = chpl_bytes_hash(x._buffer(), x.len);
       }
-      hash = locHash;
     }
-    return hash:uint;
+    return hash;
   }
 
   //
@@ -77,10 +77,8 @@ module StringCasts {
       }
     }
 
-    var ret: string;
-    ret.buff = csc:c_ptr(uint(8));
-    ret.len = strlen(csc).safeCast(int);
-    ret._size = ret.len+1;
+    const len = strlen(csc).safeCast(int);
+    var ret = new string(csc, length=len, isowned=true, needToCopy=false);
 
     return ret;
   }
@@ -172,10 +170,8 @@ module StringCasts {
 
     var csc = real_to_c_string(x:real(64), isImag);
 
-    var ret: string;
-    ret.buff = csc:c_ptr(uint(8));
-    ret.len = strlen(csc).safeCast(int);
-    ret._size = ret.len+1;
+    const len = strlen(csc).safeCast(int);
+    var ret = new string(csc, length=len, isowned=true, needToCopy=false);
 
     return ret;
   }
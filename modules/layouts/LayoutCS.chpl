@@ -377,132 +377,47 @@ class CSDom: BaseSparseDomImpl {
       bulkAdd_prepareInds(inds, dataSorted, isUnique, cmp=_columnComparator);
     }
 
-    if nnz == 0 {
-
-      const dupCount = if isUnique then 0 else _countDuplicates(inds);
-
-      nnz += inds.size-dupCount;
-      _bulkGrow();
-
-      var idxIdx = 1;
-      var prevIdx = parentDom.low - (1,1);
-      var current: idxType;
-
-      if this.compressRows then
-        current = parentDom.dim(1).low;
-      else
-        current = parentDom.dim(2).low;
-
-      // Update startIdx && idx
-      for (i,j) in inds {
-        if !isUnique && (i,j) == prevIdx then continue;
-        else prevIdx = (i,j);
-
-        if this.compressRows {
-          while i != current {
-            current += 1;
-            startIdx[current+1] = startIdx[current];
-          }
-          startIdx[i+1] += 1;
-          idx[idxIdx] = j;
-          idxIdx += 1;
-        } else {
-          while j != current {
-            current += 1;
-            startIdx[current+1] = startIdx[current];
-          }
-          startIdx[j+1] += 1;
-          idx[idxIdx] = i;
-          idxIdx += 1;
-        }
-      }
-
-
-      // make sure startIdx[i]>startIdx[j] for i>j for possibly
-      // untouched part of startIdx
-      const startIdxHigh = startIdx[current+1];
-      for r in current+2..startIdx.domain.high {
-        startIdx[r] = startIdxHigh;
-      }
-
-      return idxIdx-1;
-    } // if nnz == 0
-
-    const (actualInsertPts, actualAddCnt) =
+    const (actualInsertPts, actualAddCnt, addedPos) =
       __getActualInsertPts(this, inds, isUnique);
 
+    if actualAddCnt == 0 then return 0;
+
     const oldnnz = nnz;
     nnz += actualAddCnt;
 
     // Grow nnzDom if necessary
     _bulkGrow();
 
-    // Linearly fill the new idx from backwards
-    var newIndIdx = indsDom.high; //index into new indices
-    var oldIndIdx = oldnnz; //index into old indices
-    var newLoc = actualInsertPts[newIndIdx]; // its position-to-be in new dom
-    while newLoc == -1 {
-      newIndIdx -= 1;
-      if newIndIdx == indsDom.low-1 then break; // there were duplicates -- now done
-      newLoc = actualInsertPts[newIndIdx];
-    }
-
-    var arrShiftMap: [{1..oldnnz}] int; //to map where data goes
+    const arrShiftMap = __getShiftMap(actualInsertPts, addedPos, oldnnz);
 
-    for i in 1..nnz by -1 {
-      if oldIndIdx >= 1 && i > newLoc {
-        // Shift from old values
-        idx[i] = idx[oldIndIdx];
-        arrShiftMap[oldIndIdx] = i;
-        oldIndIdx -= 1;
-      }
-      else if newIndIdx >= indsDom.low && i == newLoc {
-        // Put the new guy in
-        if this.compressRows {
-          idx[i] = inds[newIndIdx][2];
-        } else {
-          idx[i] = inds[newIndIdx][1];
-        }
-        newIndIdx -= 1;
-        if newIndIdx >= indsDom.low then
-          newLoc = actualInsertPts[newIndIdx];
-        else
-          newLoc = -2; // Finished new set
-        while newLoc == -1 {
-          newIndIdx -= 1;
-          if newIndIdx == indsDom.low-1 then break; // There were duplicates -- now done
-          newLoc = actualInsertPts[newIndIdx];
-        }
-      }
-      else halt("Something went wrong");
+    // Move the old indices up to make room, then fill in the new ones
+    if oldnnz > 0 {
+      const oldIdx: [1..oldnnz] idxType = idx[1..oldnnz];
+      forall i in 1..oldnnz do idx[arrShiftMap[i]] = oldIdx[i];
+    }
+    forall p in addedPos {
+      if this.compressRows then
+        idx[actualInsertPts[p]] = inds[p][2];
+      else
+        idx[actualInsertPts[p]] = inds[p][1];
     }
 
-    // Aggregated row || col shift
-    var prevCursor = if this.compressRows then parentDom.dim(1).low else parentDom.dim(2).low;
-    var cursor: int;
-    var cursorCnt = 0;
-    for (ind, p) in zip(inds, actualInsertPts)  {
-      if p == -1 then continue;
-      if this.compressRows {
-        cursor = ind[1];
-      } else {
-        cursor = ind[2];
-      }
-      if cursor == prevCursor then cursorCnt += 1;
-      else {
-        startIdx[prevCursor+1] += cursorCnt;
-        if cursor - prevCursor > 1 {
-          for i in prevCursor+2..cursor {
-            startIdx[i] += cursorCnt;
-          }
-        }
-        cursorCnt += 1;
-        prevCursor = cursor;
+    // Each row (or column) starts later by the number of added indices in
+    // the rows before it.  The added indices are in row (column) order, so
+    // that number is found with a binary search.
+    const numAdded = addedPos.size;
+    forall r in startIdxDom {
+      var lo = 0, hi = numAdded;
+      while lo < hi {
+        const mid = (lo + hi) / 2;
+        const ind = inds[addedPos[mid]];
+        const cursor = if this.compressRows then ind[1] else ind[2];
+        if cursor < r then lo = mid + 1;
+        else hi = mid;
       }
+      startIdx[r] += lo;
     }
-    for i in prevCursor+1..startIdxDom.high {
-      startIdx[i] += cursorCnt;
-    }
+
     for a in _arrs do
       a.sparseBulkShiftArray(arrShiftMap, oldnnz);
 
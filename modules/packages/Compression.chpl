@@ -0,0 +1,214 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+
+Reading and writing gzip-compressed files with channels
+
+This module allows a compressed file to be opened as a :record:`~IO.file`
+whose contents are the uncompressed data.  Channels created from such a file
+compress or decompress the data as it is written or read, so existing code
+that reads or writes a file can work with compressed files by only changing
+how the file is opened:
+
+.. code-block:: chapel
+
+   use Compression;
+
+   var f = openCompressed("data.txt.gz", iomode.r);
+   forall line in f.lines() do
+     process(line);
+
+Dependencies
+------------
+
+This module requires `zlib <https://zlib.net/>`_, which is usually installed
+with the system compiler.
+
+File Format
+-----------
+
+Files written by this module consist of a series of gzip members, each
+holding at most 64KiB of data.  Each member records its compressed size in
+a ``BC`` extra field, following the BGZF format used by ``bgzip``.  Any
+gzip tool, such as ``gunzip`` or ``zcat``, can read these files.
+
+Since every member can be found without decompressing the ones before it,
+files in this format can be read starting at any offset, and several
+channels can read different parts of the file at the same time.  For
+example, iterating over :proc:`~IO.file.lines` with a ``forall`` loop
+decompresses different parts of the file in parallel.
+
+Other gzip files, such as those written by ``gzip``, can also be read, but
+only from the start by a single channel, and their length is not known in
+advance.  To read such a file in parallel, convert it first, for example
+with ``bgzip``, or by decompressing it with one channel and writing the data
+to a file opened with :proc:`openCompressed`.
+
+When writing, the data must be written in order, starting at offset 0, and
+the file can not be read and written at the same time.  To compress an
+existing file using several tasks, use :proc:`compressFile`.
+
+ */
+module Compression {
+  use IO, SysError, SysCTypes;
+
+  require "zlib.h", "-lz", "CompressionHelper/qio_plugin_gzip.h";
+
+  /*
+     The compression level used when none is specified, from 0 (no
+     compression) to 9 (best compression).
+   */
+  config const defaultCompressionLevel = 6;
+
+  /*
+     The number of blocks of data that each task compresses at a time in
+     :proc:`compressFile`.
+   */
+  config const compressBlocksPerTask = 16;
+
+  private extern const CHPL_GZ_BLOCK_SIZE:c_int;
+  private extern const CHPL_GZ_MAX_MEMBER:c_int;
+
+  private extern proc chpl_gz_open_file(ref file_out:qio_file_ptr_t,
+                                        path:c_string, access:c_string,
+                                        iohints:c_int, const ref style:iostyle,
+                                        level:c_int):syserr;
+
+  private extern proc chpl_gz_compress_block(src:c_void_ptr, len:size_t,
+                                             level:c_int, dst:c_void_ptr,
+                                             ref dst_len:size_t):syserr;
+
+  private proc checkLevel(level:int, fn:string) throws {
+    if level < 0 || level > 9 then
+      try ioerror(EINVAL:syserr, "in " + fn + ": invalid compression level",
+                  level:string);
+  }
+
+  /*
+     Open a gzip-compressed file.  Channels created from the returned file
+     read and write the uncompressed data.
+
+     :arg path: the path of the compressed file
+     :arg mode: :enum:`~IO.iomode.r` to read the file or
+                :enum:`~IO.iomode.cw` to create or replace it.  Other modes
+                are not supported.
+     :arg hints: optional argument to specify any hints to the I/O system
+                 about this file.  See :type:`~IO.iohints`.
+     :arg style: optional argument to specify the default I/O style for
+                 channels created from this file.
+     :arg level: the compression level to use when writing, from 0 (no
+                 compression) to 9 (best compression)
+     :returns: a :record:`~IO.file` whose contents are the uncompressed data
+
+     :throws SystemError: Thrown if the file could not be opened, or if the
+                          mode or level is invalid.
+   */
+  proc openCompressed(path:string, mode:iomode, hints:iohints=IOHINT_NONE,
+                      style:iostyle = defaultIOStyle(),
+                      level:int = defaultCompressionLevel):file throws {
+    if mode != iomode.r && mode != iomode.cw then
+      try ioerror(EINVAL:syserr,
+                  "in openCompressed: mode must be iomode.r or iomode.cw",
+                  path);
+    try checkLevel(level, "openCompressed");
+
+    var local_style = style;
+    var ret:file;
+    ret.home = here;
+    const err = chpl_gz_open_file(ret._file_internal, path.localize().c_str(),
+                                  _modestring(mode).c_str(), hints,
+                                  local_style, level:c_int);
+    if err then try ioerror(err, "in openCompressed", path);
+    return ret;
+  }
+
+  /*
+     Compress the file at ``src`` into a new file at ``dst``, using several
+     tasks to compress different parts of the file.  The result can be read
+     with :proc:`openCompressed` or with any gzip tool.
+
+     :arg src: the path of the file to compress
+     :arg dst: the path of the compressed file to create or replace
+     :arg level: the compression level, from 0 (no compression) to 9 (best
+                 compression)
+
+     :throws SystemError: Thrown if either file could not be opened, read or
+                          written, or if the level is invalid.
+   */
+  proc compressFile(src:string, dst:string,
+                    level:int = defaultCompressionLevel) throws {
+    try checkLevel(level, "compressFile");
+
+    const inFile = try open(src, iomode.r);
+    const len = try inFile.length();
+    const outFile = try open(dst, iomode.cw);
+    var r = try inFile.reader(kind=iokind.native, locking=false);
+    var w = try outFile.writer(kind=iokind.native, locking=false);
+
+    const blockSize = CHPL_GZ_BLOCK_SIZE:int;
+    const maxMember = CHPL_GZ_MAX_MEMBER:int;
+    const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                     else dataParTasksPerLocale;
+    const blocksPerRound = max(1, numTasks * compressBlocksPerTask);
+
+    var raw = c_malloc(uint(8), blocksPerRound * blockSize);
+    var packed = c_malloc(uint(8), blocksPerRound * maxMember);
+    defer {
+      c_free(raw);
+      c_free(packed);
+    }
+    var sizes:[0..#blocksPerRound] size_t;
+    var errs:[0..#blocksPerRound] syserr;
+
+    // Read a round of blocks, compress them in parallel, then write them
+    // out in order.
+    var done = 0;
+    while done < len {
+      const roundLen = min(len - done, blocksPerRound * blockSize);
+      const numBlocks = (roundLen + blockSize - 1) / blockSize;
+      try r.readBytes(raw, roundLen:ssize_t);
+
+      forall b in 0..#numBlocks {
+        const blockLen = min(blockSize, roundLen - b * blockSize);
+        errs[b] = chpl_gz_compress_block(c_ptrTo(raw[b * blockSize]),
+                                         blockLen:size_t, level:c_int,
+                                         c_ptrTo(packed[b * maxMember]),
+                                         sizes[b]);
+      }
+
+      for b in 0..#numBlocks {
+        if errs[b] then try ioerror(errs[b], "in compressFile", src);
+        try w.writeBytes(c_ptrTo(packed[b * maxMember]), sizes[b]:ssize_t);
+      }
+      done += roundLen;
+    }
+
+    // An empty block marks the end of the file.
+    var eofLen:size_t;
+    const err = chpl_gz_compress_block(c_nil, 0, level:c_int, packed, eofLen);
+    if err then try ioerror(err, "in compressFile", dst);
+    try w.writeBytes(packed, eofLen:ssize_t);
+
+    try r.close();
+    try w.close();
+    try inFile.close();
+    try outFile.close();
+  }
+}
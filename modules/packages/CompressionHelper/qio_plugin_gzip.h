@@ -0,0 +1,700 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _QIO_PLUGIN_GZIP_H_
+#define _QIO_PLUGIN_GZIP_H_
+
+#include "zlib.h"
+#include "chplrt.h"
+#include "qio.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+// The helper functions are defined in this header rather than in a .c
+// file for the same reason as in ZMQHelper/zmq_helper.h: this header is
+// only `require`d by the Compression module, so zlib is only needed by
+// programs that use it.
+//
+// Files are written as a sequence of independent gzip members, each
+// holding at most CHPL_GZ_BLOCK_SIZE bytes of data and carrying its
+// compressed size in a 'BC' extra subfield.  This is the BGZF layout used
+// by bgzip, so the files can be read by gunzip and friends.  Because
+// every member can be found from the headers alone and decompressed on
+// its own, reading such a file only needs an index of the members, and
+// reads at different offsets do not need to share any state.  Other gzip
+// files are read as a single stream.
+
+#define CHPL_GZ_BLOCK_SIZE 0xff00
+#define CHPL_GZ_MAX_MEMBER 0x10000
+#define CHPL_GZ_HEADER_SIZE 18
+#define CHPL_GZ_TRAILER_SIZE 8
+#define CHPL_GZ_CACHE_SLOTS 8
+
+#define FTYPE_GZIP 4
+
+typedef struct chpl_gz_cache_slot_s {
+  int64_t block;       // block held in data, or -1
+  uint32_t len;
+  unsigned char data[CHPL_GZ_BLOCK_SIZE];
+} chpl_gz_cache_slot_t;
+
+typedef struct chpl_gz_file_s {
+  int fd;
+  int writing;
+  int level;
+  qio_lock_t lock;
+
+  // Reading blocked files.  Block i holds the data at
+  // uoff[i]..uoff[i+1]-1 and is stored at coff[i]..coff[i+1]-1.
+  int64_t nblocks;
+  int64_t* coff;
+  int64_t* uoff;
+  // Blocks that were only partly needed by a read, so that the next read
+  // of the same block does not decompress it again.
+  chpl_gz_cache_slot_t* cache;
+
+  // Reading other gzip files, one stream at a time.
+  gzFile stream;
+
+  // Writing.  Data not yet compressed and the offset after it.
+  unsigned char* pending;
+  size_t npending;
+  int64_t write_pos;
+} chpl_gz_file_t;
+
+static inline chpl_gz_file_t* to_gz_file(void* fl) {
+  return (chpl_gz_file_t*) fl;
+}
+
+static qioerr chpl_gz_zlib_error(int rc) {
+  if (rc == Z_MEM_ERROR)
+    QIO_RETURN_CONSTANT_ERROR(ENOMEM, "out of memory in zlib");
+  QIO_RETURN_CONSTANT_ERROR(EILSEQ, "corrupt gzip data");
+}
+
+static void chpl_gz_put16(unsigned char* p, uint32_t x) {
+  p[0] = x & 0xff;
+  p[1] = (x >> 8) & 0xff;
+}
+
+static void chpl_gz_put32(unsigned char* p, uint32_t x) {
+  chpl_gz_put16(p, x & 0xffff);
+  chpl_gz_put16(p + 2, x >> 16);
+}
+
+static uint32_t chpl_gz_get16(const unsigned char* p) {
+  return p[0] | ((uint32_t) p[1] << 8);
+}
+
+static uint32_t chpl_gz_get32(const unsigned char* p) {
+  return chpl_gz_get16(p) | (chpl_gz_get16(p + 2) << 16);
+}
+
+// Read exactly len bytes at offset, returning EEOF if the file is shorter.
+static qioerr chpl_gz_pread_all(int fd, void* buf, size_t len, off_t offset) {
+  size_t got = 0;
+  while (got < len) {
+    ssize_t n = pread(fd, (char*) buf + got, len - got, offset + got);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return qio_int_to_err(errno);
+    }
+    if (n == 0) return QIO_EEOF;
+    got += n;
+  }
+  return 0;
+}
+
+static qioerr chpl_gz_write_all(int fd, const void* buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = write(fd, (const char*) buf + done, len - done);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return qio_int_to_err(errno);
+    }
+    done += n;
+  }
+  return 0;
+}
+
+// Compress len <= CHPL_GZ_BLOCK_SIZE bytes from src into a single gzip
+// member in dst, which must have room for CHPL_GZ_MAX_MEMBER bytes.  The
+// size of the member is returned in dst_len.
+static qioerr chpl_gz_compress_block(const void* src, size_t len, int level,
+                                     void* dst, size_t* dst_len)
+{
+  unsigned char* out = (unsigned char*) dst;
+  z_stream strm;
+  int rc;
+  size_t clen;
+
+  if (len > CHPL_GZ_BLOCK_SIZE)
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "gzip block too large");
+
+  while (1) {
+    memset(&strm, 0, sizeof(strm));
+    rc = deflateInit2(&strm, level, Z_DEFLATED, -MAX_WBITS, 8,
+                      Z_DEFAULT_STRATEGY);
+    if (rc != Z_OK) return chpl_gz_zlib_error(rc);
+
+    strm.next_in = (Bytef*) src;
+    strm.avail_in = len;
+    strm.next_out = out + CHPL_GZ_HEADER_SIZE;
+    strm.avail_out = CHPL_GZ_MAX_MEMBER - CHPL_GZ_HEADER_SIZE -
+                     CHPL_GZ_TRAILER_SIZE;
+    rc = deflate(&strm, Z_FINISH);
+    clen = strm.total_out;
+    deflateEnd(&strm);
+
+    if (rc == Z_STREAM_END) break;
+    // Data that does not compress can overflow the member; store it.
+    if (level == 0) return chpl_gz_zlib_error(rc);
+    level = 0;
+  }
+
+  out[0] = 0x1f;             // ID1
+  out[1] = 0x8b;             // ID2
+  out[2] = 8;                // CM = deflate
+  out[3] = 4;                // FLG = FEXTRA
+  chpl_gz_put32(out + 4, 0); // MTIME
+  out[8] = 0;                // XFL
+  out[9] = 0xff;             // OS = unknown
+  chpl_gz_put16(out + 10, 6);// XLEN
+  out[12] = 'B';
+  out[13] = 'C';
+  chpl_gz_put16(out + 14, 2);
+  clen += CHPL_GZ_HEADER_SIZE + CHPL_GZ_TRAILER_SIZE;
+  chpl_gz_put16(out + 16, clen - 1);
+
+  chpl_gz_put32(out + clen - 8,
+                crc32(crc32(0, NULL, 0), (const Bytef*) src, len));
+  chpl_gz_put32(out + clen - 4, len);
+
+  *dst_len = clen;
+  return 0;
+}
+
+// Decompress the member in src..src+src_len-1 into dst, which must have
+// room for exactly dst_len bytes.
+static qioerr chpl_gz_decompress_block(const void* src, size_t src_len,
+                                       void* dst, size_t dst_len)
+{
+  z_stream strm;
+  int rc;
+
+  memset(&strm, 0, sizeof(strm));
+  rc = inflateInit2(&strm, 16 + MAX_WBITS);
+  if (rc != Z_OK) return chpl_gz_zlib_error(rc);
+
+  strm.next_in = (Bytef*) src;
+  strm.avail_in = src_len;
+  strm.next_out = (Bytef*) dst;
+  strm.avail_out = dst_len;
+  rc = inflate(&strm, Z_FINISH);
+  if (rc == Z_STREAM_END && strm.total_out != dst_len) rc = Z_DATA_ERROR;
+  inflateEnd(&strm);
+
+  if (rc != Z_STREAM_END) return chpl_gz_zlib_error(rc);
+  return 0;
+}
+
+// Return the size of the blocked gzip member whose header is in hdr,
+// or 0 if hdr is not the header of such a member.
+static size_t chpl_gz_member_size(const unsigned char* hdr) {
+  if (hdr[0] != 0x1f || hdr[1] != 0x8b || hdr[2] != 8 || !(hdr[3] & 4))
+    return 0;
+  if (chpl_gz_get16(hdr + 10) != 6 || hdr[12] != 'B' || hdr[13] != 'C' ||
+      chpl_gz_get16(hdr + 14) != 2)
+    return 0;
+  return chpl_gz_get16(hdr + 16) + 1;
+}
+
+// Find the blocks of a file written in the blocked layout.  Leaves
+// nblocks at -1 if the file is some other gzip file.
+static qioerr chpl_gz_build_index(chpl_gz_file_t* fl) {
+  unsigned char hdr[CHPL_GZ_HEADER_SIZE];
+  unsigned char isize[4];
+  int64_t cap = 16;
+  int64_t n = 0;
+  int64_t coff = 0;
+  int64_t uoff = 0;
+  qioerr err;
+
+  fl->nblocks = -1;
+  fl->coff = (int64_t*) qio_malloc(cap * sizeof(int64_t));
+  fl->uoff = (int64_t*) qio_malloc(cap * sizeof(int64_t));
+  if (!fl->coff || !fl->uoff) return QIO_ENOMEM;
+
+  while (1) {
+    size_t bsize;
+
+    err = chpl_gz_pread_all(fl->fd, hdr, sizeof(hdr), coff);
+    if (qio_err_to_int(err) == EEOF) break;
+    if (err) return err;
+
+    bsize = chpl_gz_member_size(hdr);
+    if (bsize < CHPL_GZ_HEADER_SIZE + CHPL_GZ_TRAILER_SIZE) {
+      // Not our layout.  That is only OK at the start of the file.
+      if (n == 0) return 0;
+      QIO_RETURN_CONSTANT_ERROR(EILSEQ, "corrupt blocked gzip file");
+    }
+
+    err = chpl_gz_pread_all(fl->fd, isize, sizeof(isize), coff + bsize - 4);
+    if (qio_err_to_int(err) == EEOF)
+      QIO_RETURN_CONSTANT_ERROR(EILSEQ, "truncated gzip file");
+    if (err) return err;
+
+    if (n + 1 >= cap) {
+      int64_t* c;
+      int64_t* u;
+      cap *= 2;
+      c = (int64_t*) qio_realloc(fl->coff, cap * sizeof(int64_t));
+      if (c) fl->coff = c;
+      u = (int64_t*) qio_realloc(fl->uoff, cap * sizeof(int64_t));
+      if (u) fl->uoff = u;
+      if (!c || !u) return QIO_ENOMEM;
+    }
+
+    fl->coff[n] = coff;
+    fl->uoff[n] = uoff;
+    n++;
+    coff += bsize;
+    uoff += chpl_gz_get32(isize);
+  }
+
+  if (n == 0) {
+    // An empty file is an empty blocked file.
+    fl->coff[0] = 0;
+    fl->uoff[0] = 0;
+  }
+  fl->coff[n] = coff;
+  fl->uoff[n] = uoff;
+  fl->nblocks = n;
+  return 0;
+}
+
+// Decompress block b into dst, which has room for the whole block.
+static qioerr chpl_gz_read_block(chpl_gz_file_t* fl, int64_t b, void* dst) {
+  size_t clen = fl->coff[b+1] - fl->coff[b];
+  unsigned char* cbuf;
+  qioerr err;
+
+  cbuf = (unsigned char*) qio_malloc(clen);
+  if (!cbuf) return QIO_ENOMEM;
+
+  err = chpl_gz_pread_all(fl->fd, cbuf, clen, fl->coff[b]);
+  if (qio_err_to_int(err) == EEOF)
+    QIO_GET_CONSTANT_ERROR(err, EILSEQ, "truncated gzip file");
+  if (!err)
+    err = chpl_gz_decompress_block(cbuf, clen, dst,
+                                   fl->uoff[b+1] - fl->uoff[b]);
+  qio_free(cbuf);
+  return err;
+}
+
+// Copy the part of block b starting skip bytes into it to dst.
+static qioerr chpl_gz_read_partial_block(chpl_gz_file_t* fl, int64_t b,
+                                         size_t skip, void* dst, size_t len)
+{
+  chpl_gz_cache_slot_t* slot = &fl->cache[b % CHPL_GZ_CACHE_SLOTS];
+  unsigned char* tmp;
+  qioerr err;
+
+  err = qio_lock(&fl->lock);
+  if (err) return err;
+  if (slot->block == b) {
+    memcpy(dst, slot->data + skip, len);
+    qio_unlock(&fl->lock);
+    return 0;
+  }
+  qio_unlock(&fl->lock);
+
+  // Decompress without holding the lock so that tasks reading other
+  // blocks are not held up.
+  tmp = (unsigned char*) qio_malloc(CHPL_GZ_BLOCK_SIZE);
+  if (!tmp) return QIO_ENOMEM;
+  err = chpl_gz_read_block(fl, b, tmp);
+  if (!err) {
+    memcpy(dst, tmp + skip, len);
+    err = qio_lock(&fl->lock);
+    if (!err) {
+      slot->block = b;
+      slot->len = fl->uoff[b+1] - fl->uoff[b];
+      memcpy(slot->data, tmp, slot->len);
+      qio_unlock(&fl->lock);
+    }
+  }
+  qio_free(tmp);
+  return err;
+}
+
+// Compress and write the pending data as one block.  With 'force', an
+// empty block is written if nothing is pending.
+static qioerr chpl_gz_flush_pending(chpl_gz_file_t* fl, int force) {
+  unsigned char* out;
+  size_t clen;
+  qioerr err;
+
+  if (fl->npending == 0 && !force) return 0;
+
+  out = (unsigned char*) qio_malloc(CHPL_GZ_MAX_MEMBER);
+  if (!out) return QIO_ENOMEM;
+  err = chpl_gz_compress_block(fl->pending, fl->npending, fl->level, out,
+                               &clen);
+  if (!err) err = chpl_gz_write_all(fl->fd, out, clen);
+  if (!err) fl->npending = 0;
+  qio_free(out);
+  return err;
+}
+
+static
+qioerr chpl_gz_open(void** fd, const char* path, int* flags, mode_t mode,
+                    qio_hint_t iohints, void* fs)
+{
+  chpl_gz_file_t* fl;
+  int accmode = *flags & O_ACCMODE;
+  qioerr err = 0;
+  int rc;
+
+  if (accmode == O_RDWR)
+    QIO_RETURN_CONSTANT_ERROR(EINVAL,
+        "gzip files can be opened for reading or writing, not both");
+
+  fl = (chpl_gz_file_t*) qio_calloc(sizeof(chpl_gz_file_t), 1);
+  if (!fl) return QIO_ENOMEM;
+
+  fl->level = (int) (intptr_t) fs;
+  fl->writing = (accmode == O_WRONLY);
+  fl->nblocks = -1;
+  fl->fd = -1;
+
+  err = qio_lock_init(&fl->lock);
+  if (err) {
+    qio_free(fl);
+    return err;
+  }
+
+  STARTING_SLOW_SYSCALL;
+  err = qio_int_to_err(sys_open(path, *flags, mode, &fl->fd));
+  DONE_SLOW_SYSCALL;
+  if (err) goto error;
+
+  if (fl->writing) {
+    fl->pending = (unsigned char*) qio_malloc(CHPL_GZ_BLOCK_SIZE);
+    if (!fl->pending) {
+      err = QIO_ENOMEM;
+      goto error;
+    }
+    *flags = QIO_FDFLAG_WRITEABLE | QIO_FDFLAG_SEEKABLE;
+  } else {
+    STARTING_SLOW_SYSCALL;
+    err = chpl_gz_build_index(fl);
+    DONE_SLOW_SYSCALL;
+    if (err) goto error;
+
+    if (fl->nblocks >= 0) {
+      int i;
+      fl->cache = (chpl_gz_cache_slot_t*)
+        qio_malloc(CHPL_GZ_CACHE_SLOTS * sizeof(chpl_gz_cache_slot_t));
+      if (!fl->cache) {
+        err = QIO_ENOMEM;
+        goto error;
+      }
+      for (i = 0; i < CHPL_GZ_CACHE_SLOTS; i++) fl->cache[i].block = -1;
+      *flags = QIO_FDFLAG_READABLE | QIO_FDFLAG_SEEKABLE;
+    } else {
+      // Some other gzip file (or not compressed at all, which zlib reads
+      // as is).  It can only be read from the start.
+      rc = dup(fl->fd);
+      if (rc >= 0) fl->stream = gzdopen(rc, "rb");
+      if (!fl->stream) {
+        if (rc >= 0) close(rc);
+        err = QIO_ENOMEM;
+        goto error;
+      }
+      gzbuffer(fl->stream, 1 << 20);
+      *flags = QIO_FDFLAG_READABLE;
+    }
+  }
+
+  *fd = fl;
+  return 0;
+
+error:
+  if (fl->fd >= 0) sys_close(fl->fd);
+  qio_free(fl->coff);
+  qio_free(fl->uoff);
+  qio_free(fl->cache);
+  qio_free(fl->pending);
+  qio_lock_destroy(&fl->lock);
+  qio_free(fl);
+  return err;
+}
+
+static
+qioerr chpl_gz_close(void* fl, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+  qioerr err = 0;
+  qioerr close_err;
+
+  if (gz->writing) {
+    err = chpl_gz_flush_pending(gz, 0);
+    // An empty member marks the end of the file.
+    if (!err) err = chpl_gz_flush_pending(gz, 1);
+  }
+
+  if (gz->stream) gzclose(gz->stream);
+  close_err = qio_int_to_err(sys_close(gz->fd));
+  if (!err) err = close_err;
+
+  qio_free(gz->coff);
+  qio_free(gz->uoff);
+  qio_free(gz->cache);
+  qio_free(gz->pending);
+  qio_lock_destroy(&gz->lock);
+  qio_free(gz);
+  return err;
+}
+
+static
+qioerr chpl_gz_preadv(void* fl, const struct iovec* vector, int count,
+                      off_t offset, ssize_t* num_read_out, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+  ssize_t total = 0;
+  int64_t b;
+  int64_t lo, hi;
+  qioerr err = 0;
+  int i;
+
+  *num_read_out = 0;
+  if (gz->nblocks < 0 || gz->writing)
+    QIO_RETURN_CONSTANT_ERROR(ESPIPE, "gzip stream is not seekable");
+  if (offset >= gz->uoff[gz->nblocks]) {
+    for (i = 0; i < count; i++)
+      if (vector[i].iov_len > 0) return QIO_EEOF;
+    return 0;
+  }
+
+  // Find the block containing offset.
+  lo = 0;
+  hi = gz->nblocks - 1;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo + 1) / 2;
+    if (gz->uoff[mid] <= offset) lo = mid;
+    else hi = mid - 1;
+  }
+  b = lo;
+
+  STARTING_SLOW_SYSCALL;
+  for (i = 0; i < count && b < gz->nblocks && !err; i++) {
+    unsigned char* dst = (unsigned char*) vector[i].iov_base;
+    size_t left = vector[i].iov_len;
+
+    while (left > 0 && b < gz->nblocks) {
+      int64_t pos = offset + total;
+      size_t skip = pos - gz->uoff[b];
+      size_t blen = gz->uoff[b+1] - gz->uoff[b];
+      size_t len = blen - skip;
+      if (len > left) len = left;
+
+      if (skip == 0 && len == blen)
+        err = chpl_gz_read_block(gz, b, dst);
+      else
+        err = chpl_gz_read_partial_block(gz, b, skip, dst, len);
+      if (err) break;
+
+      dst += len;
+      left -= len;
+      total += len;
+      if (skip + len == blen) b++;
+    }
+  }
+  DONE_SLOW_SYSCALL;
+
+  *num_read_out = total;
+  // Report a short read rather than an error after some progress.
+  if (total > 0) return 0;
+  return err;
+}
+
+static
+qioerr chpl_gz_readv(void* fl, const struct iovec* vector, int count,
+                     ssize_t* num_read_out, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+  ssize_t total = 0;
+  qioerr err = 0;
+  int i;
+
+  *num_read_out = 0;
+  if (!gz->stream)
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "gzip file not open for streaming");
+
+  STARTING_SLOW_SYSCALL;
+  for (i = 0; i < count; i++) {
+    int got;
+    unsigned int len = vector[i].iov_len;
+    if (len == 0) continue;
+    got = gzread(gz->stream, vector[i].iov_base, len);
+    if (got < 0) {
+      int zerr;
+      gzerror(gz->stream, &zerr);
+      if (zerr == Z_ERRNO) err = qio_int_to_err(errno);
+      else err = chpl_gz_zlib_error(zerr);
+      break;
+    }
+    total += got;
+    if ((unsigned int) got < len) {
+      if (total == 0) err = QIO_EEOF;
+      break;
+    }
+  }
+  DONE_SLOW_SYSCALL;
+
+  *num_read_out = total;
+  if (total > 0) return 0;
+  return err;
+}
+
+static
+qioerr chpl_gz_pwritev(void* fl, const struct iovec* vector, int count,
+                       off_t offset, ssize_t* num_written_out, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+  ssize_t total = 0;
+  qioerr err = 0;
+  int i;
+
+  *num_written_out = 0;
+  if (offset != gz->write_pos)
+    QIO_RETURN_CONSTANT_ERROR(ESPIPE, "gzip files must be written in order");
+
+  STARTING_SLOW_SYSCALL;
+  for (i = 0; i < count && !err; i++) {
+    const unsigned char* src = (const unsigned char*) vector[i].iov_base;
+    size_t left = vector[i].iov_len;
+    while (left > 0) {
+      size_t len = CHPL_GZ_BLOCK_SIZE - gz->npending;
+      if (len > left) len = left;
+      memcpy(gz->pending + gz->npending, src, len);
+      gz->npending += len;
+      src += len;
+      left -= len;
+      total += len;
+      if (gz->npending == CHPL_GZ_BLOCK_SIZE) {
+        err = chpl_gz_flush_pending(gz, 0);
+        if (err) break;
+      }
+    }
+  }
+  DONE_SLOW_SYSCALL;
+
+  // Data copied to the pending block counts as written even if an
+  // earlier block could not be written.
+  gz->write_pos += total;
+  *num_written_out = total;
+  return err;
+}
+
+static
+qioerr chpl_gz_seek(void* fl, off_t offset, int whence, off_t* offset_out,
+                    void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+
+  // Only used to find the starting position when the file is opened.
+  if (gz->stream) QIO_RETURN_CONSTANT_ERROR(ESPIPE, "gzip stream is not seekable");
+  if (offset != 0 || whence != SEEK_CUR)
+    QIO_RETURN_CONSTANT_ERROR(ENOSYS, "seek not supported for gzip files");
+  *offset_out = 0;
+  return 0;
+}
+
+static
+qioerr chpl_gz_getlength(void* fl, int64_t* len_out, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+
+  if (gz->writing) {
+    *len_out = gz->write_pos;
+    return 0;
+  }
+  if (gz->nblocks < 0) {
+    *len_out = 0;
+    QIO_RETURN_CONSTANT_ERROR(ENOTSUP, "Unable to get length of gzip stream");
+  }
+  *len_out = gz->uoff[gz->nblocks];
+  return 0;
+}
+
+static
+qioerr chpl_gz_fsync(void* fl, void* fs)
+{
+  chpl_gz_file_t* gz = to_gz_file(fl);
+  qioerr err = 0;
+
+  if (gz->writing) {
+    // Ending a block early only costs some compression.
+    err = chpl_gz_flush_pending(gz, 0);
+    if (!err) err = qio_int_to_err(sys_fsync(gz->fd));
+  }
+  return err;
+}
+
+static
+int chpl_gz_get_fs_type(void* fl, void* fs)
+{
+  return FTYPE_GZIP;
+}
+
+// No getpath: the path names the compressed data, and code that reopens a
+// file by its path would read that instead of the contents.
+static qio_file_functions_t chpl_gz_function_struct = {
+    NULL,                 // writev
+    &chpl_gz_readv,       // readv
+    &chpl_gz_pwritev,     // pwritev
+    &chpl_gz_preadv,      // preadv
+    &chpl_gz_close,       // close
+    &chpl_gz_open,        // open
+    &chpl_gz_seek,        // seek
+    &chpl_gz_getlength,   // filelength
+    NULL,                 // getpath
+    &chpl_gz_fsync,       // fsync
+    NULL,                 // getcwd
+    &chpl_gz_get_fs_type, // get_fs_type
+    NULL,                 // get_chunk
+    NULL,                 // get_locales_for_region
+};
+
+static inline
+qioerr chpl_gz_open_file(qio_file_t** file_out, const char* path,
+                         const char* access, qio_hint_t iohints,
+                         const qio_style_t* style, int level)
+{
+  return qio_file_open_access_usr(file_out, path, access, iohints, style,
+                                  (void*) (intptr_t) level,
+                                  &chpl_gz_function_struct);
+}
+
+#endif
@@ -93,7 +93,9 @@
   While the bag is safe to use in a distributed manner, each node always operates on it's privatized
   instance. This means that it is easy to add data in bulk, expecting it to be distributed, when in
   reality it is not; if another node needs data, it will steal work on-demand. This may not always be
-  desired, and likely will more memory consumption on a single node. We offer a way for the user to
+  desired, and likely will more memory consumption on a single node. When a bulk insertion leaves one
+  node with far more than its share, its excess is moved to other nodes automatically (see
+  :const:`distributedBagRebalanceRatio`). We also offer a way for the user to
   invoke a more static load balancing approach, called :proc:`balance`, which will redistributed work.
 
   .. code-block:: chapel
@@ -114,7 +116,8 @@
   2.  Static work-stealing (A.K.A :proc:`balance`) requires a rework that performs a more distributed
       and fast way of distributing memory, as currently 'excess' elements are shifted to a single
       node to be redistributed in the next pass. On the note, we need to collapse the pass for moving
-      excess elements into a single pass, hopefully with a zero-copy overhead.
+      excess elements into a single pass, hopefully with a zero-copy overhead. Bulk insertions
+      already move elements directly between nodes (see :const:`distributedBagRebalanceRatio`).
 
   Methods
   _______
@@ -195,6 +198,17 @@ module DistributedBag {
     usage does not rapidly grow out of control.
   */
   config const distributedBagMaxBlockSize = 1024 * 1024;
+  /*
+    After a bulk insertion (see :proc:`DistributedBagImpl.addBulk`), if this node
+    holds more than this many times the average number of elements per node, it
+    gives its excess elements to the nodes with fewer than the average. Only the
+    segments taking part in each transfer are locked, and only one at a time, so
+    the bag remains usable by other tasks meanwhile. Since finding the average
+    requires asking every node, a node only checks again once it holds this many
+    times as many elements as when it last checked. Setting this to 0 disables
+    this rebalancing.
+  */
+  config const distributedBagRebalanceRatio = 2.0;
 
   /*
     Reference counter for DistributedBag
@@ -269,6 +283,9 @@ module DistributedBag {
     // To access them from another node, make sure you use 'getPrivatizedThis'
     pragma "no doc"
     var bag : unmanaged Bag(eltType);
+    // The number of elements this node held after its last rebalance check.
+    pragma "no doc"
+    var rebalanceCheckedElems : atomic int;
 
     proc init(type eltType, targetLocales : [?targetLocDom] locale = Locales) {
       super.init(eltType);
@@ -341,6 +358,48 @@ module DistributedBag {
       return bag.remove();
     }
 
+    /*
+      Insert elements in bulk to this node's bag. The elements are split
+      between the segments, which are filled in parallel, and each segment is
+      locked once for its whole share rather than once per element. If this
+      leaves this node with far more elements than the others (see
+      :const:`distributedBagRebalanceRatio`), some of them are moved to other
+      nodes. This is only checked when this node's element count has grown
+      by that ratio since the last check, so most bulk insertions stay local.
+
+      Returns the number of elements added.
+    */
+    override proc addBulk(elts) : int {
+      var nAdded = bag.addBulk(elts);
+      if distributedBagRebalanceRatio > 0 && targetLocales.size > 1 {
+        // Gathering the counts of every node is expensive, so only do it
+        // once this node has grown by the ratio since it last checked. If
+        // elements were removed in the meantime, start from the lower count.
+        // The compare-exchange keeps concurrent callers from checking twice.
+        const nElems = bag.totalElems();
+        const nChecked = rebalanceCheckedElems.read();
+        if nElems < nChecked {
+          rebalanceCheckedElems.compareExchange(nChecked, nElems);
+        } else if nElems > distributedBagRebalanceRatio * nChecked &&
+                  rebalanceCheckedElems.compareExchange(nChecked, nElems) {
+          rebalance();
+          rebalanceCheckedElems.write(bag.totalElems());
+        }
+      }
+      return nAdded;
+    }
+
+    /*
+      Remove up to `nElts` elements from this node's bag, returning them as an
+      array. Elements are taken a segment at a time, locking each segment once;
+      if this node's bag does not have enough, the rest are removed as in
+      :proc:`remove`, which may steal elements from other nodes. The array is
+      shorter than `nElts` if the bag runs out of elements.
+    */
+    override proc removeBulk(nElts : int) {
+      return bag.removeBulk(nElts);
+    }
+
     /*
       Obtain the number of elements held in all bags across all nodes. This method
       is best-effort and can be non-deterministic for concurrent updates across nodes,
@@ -407,9 +466,13 @@ module DistributedBag {
       elements fairly for bags across nodes. The result will result in all segments
       having roughly the same amount of elements.
 
+      Segments are balanced independently of each other, and each segment is
+      only locked while elements are moved into or out of it, so other
+      operations may proceed on the rest of the bag meanwhile.
+
       .. note::
 
-        This method is very heavy-weight in that it should not be called too
+        This method is heavy-weight in that it should not be called too
         often. Dynamic work stealing handles cases where there is a relatively fair
         distribution across majority of nodes, but this should be called when you have
         a severe imbalance, or when you have a smaller number of elements to balance.
@@ -418,18 +481,9 @@ module DistributedBag {
     */
     proc balance() {
       var localThis = getPrivatizedThis;
-      // Phase 1: Acquire all locks from from first node and segment to last
-      // node and segment (our global locking order...)
-      for loc in localThis.targetLocales do on loc {
-        var instance = getPrivatizedThis;
-        for segmentIdx in 0 .. #here.maxTaskPar {
-          ref segment = instance.bag.segments[segmentIdx];
-          segment.acquire(STATUS_BALANCE);
-        }
-      }
 
-      // Phase 2: Concurrently redistribute elements from segments which contain
-      // more than the computed average.
+      // Redistribute elements from segments which contain more than the
+      // computed average, concurrently for each segment index.
       coforall segmentIdx in 0 .. #here.maxTaskPar {
         var nSegmentElems : [localThis.targetLocales.size] int;
         var locIdx = 0;
@@ -441,7 +495,8 @@ module DistributedBag {
 
         // Find the average and the excess. The excess is calculated as the amount
         // of elements a segment has over the average, which is used to calculate
-        // the buffer size for each segment.
+        // the buffer size for each segment. The counts may change before each
+        // segment is locked, so they are only used as an upper bound.
         var total = (+ reduce nSegmentElems);
         var avg = total / locIdx;
         var excess : int;
@@ -458,58 +513,84 @@ module DistributedBag {
         for loc in localThis.targetLocales do on loc {
           var average = avg;
           ref segment = getPrivatizedThis.bag.segments[segmentIdx];
+          segment.acquire(STATUS_BALANCE);
           var nElems = segment.nElems.read() : int;
           if nElems > average {
-            var nTransfer = nElems - average;
+            var nTransfer = min(nElems - average, excess - bufferOffset);
             var tmpBuffer = buffer + bufferOffset;
             segment.transferElements(tmpBuffer, nTransfer, buffer.locale.id);
             bufferOffset += nTransfer;
           }
+          segment.releaseStatus();
         }
 
         // With the excess elements, redistribute it...
+        const nFilled = bufferOffset;
         bufferOffset = 0;
         for loc in localThis.targetLocales do on loc {
           var average = avg;
           ref segment = getPrivatizedThis.bag.segments[segmentIdx];
+          segment.acquire(STATUS_BALANCE);
           var nElems = segment.nElems.read() : int;
           if average > nElems {
-            var give = average - nElems;
-            var arr : [1..give] eltType;
-            on bufferOffset {
-              var tmpBuffer = buffer;
-              for i in 1 .. give {
-                arr[i] = tmpBuffer[bufferOffset];
-                bufferOffset += 1;
-              }
-            }
-            for i in 1 .. give {
-              segment.addElements(arr[i]);
+            var give = min(average - nElems, nFilled - bufferOffset);
+            if give > 0 {
+              segment.addElementsPtr(buffer + bufferOffset, give, buffer.locale.id);
+              bufferOffset += give;
             }
           }
+          segment.releaseStatus();
         }
 
         // Lastly, if there are items left over, just add them to our locale's segment.
-        if excess > bufferOffset {
+        if nFilled > bufferOffset {
           ref segment = localThis.bag.segments[segmentIdx];
-          var nLeftOvers = excess - bufferOffset;
+          var nLeftOvers = nFilled - bufferOffset;
           var tmpBuffer = buffer + bufferOffset;
+          segment.acquire(STATUS_BALANCE);
           segment.addElementsPtr(tmpBuffer, nLeftOvers, buffer.locale.id);
+          segment.releaseStatus();
         }
 
         c_free(buffer);
       }
+    }
 
-      // Phase 3: Release all locks from first node and segment to last node and segment.
-      for loc in localThis.targetLocales do on loc {
-        var instance = getPrivatizedThis;
-        for segmentIdx in 0 .. #here.maxTaskPar {
-          ref segment = instance.bag.segments[segmentIdx];
-          segment.releaseStatus();
-        }
+    /*
+      If this node holds more than :const:`distributedBagRebalanceRatio` times
+      the average number of elements per node, move its excess elements to the
+      nodes with fewer than the average. Unlike :proc:`balance`, only this node's
+      excess is moved, and nodes that are not under-loaded are left alone.
+    */
+    pragma "no doc"
+    proc rebalance() {
+      var localThis = getPrivatizedThis;
+      var nLocElems : [targetLocDom] int;
+      coforall (loc, nElems) in zip(targetLocales, nLocElems) do on loc {
+        nElems = getPrivatizedThis.bag.totalElems();
       }
-    }
 
+      var myIdx = -1;
+      for (loc, locIdx) in zip(targetLocales, targetLocDom) {
+        if loc == here then myIdx = locIdx;
+      }
+      if myIdx == -1 then return;
+
+      const avg = (+ reduce nLocElems) / targetLocales.size;
+      var excess = nLocElems[myIdx] - avg;
+      if excess <= 0 || nLocElems[myIdx] <= distributedBagRebalanceRatio * avg {
+        return;
+      }
+
+      for (loc, nElems) in zip(targetLocales, nLocElems) {
+        if excess == 0 then break;
+        if nElems >= avg then continue;
+
+        const give = min(avg - nElems, excess);
+        localThis.bag.giveElements(give, loc);
+        excess -= give;
+      }
+    }
     /*
       Iterate over each bag in each node. To avoid holding onto locks, we take
       a snapshot approach, increasing memory consumption but also increasing parallelism.
@@ -950,6 +1031,107 @@ module DistributedBag {
       }
     }
 
+    proc totalElems() : int {
+      var nElems = 0;
+      for segment in segments do nElems += segment.nElems.read() : int;
+      return nElems;
+    }
+
+    proc addBulk(elts) : int {
+      const nElts = elts.size;
+      if nElts == 0 then return 0;
+
+      // Gather the elements so that each segment can copy its share at once.
+      var buffer = c_malloc(eltType, nElts);
+      var bufferOffset = 0;
+      for elt in elts {
+        buffer[bufferOffset] = elt;
+        bufferOffset += 1;
+      }
+
+      // Give each segment at least an initial block's worth of elements, so
+      // small insertions do not spread across every segment.
+      const nSegments = min(here.maxTaskPar,
+                            (nElts + distributedBagInitialBlockSize - 1) / distributedBagInitialBlockSize);
+      const startIdx = nextStartIdxEnq;
+      coforall offset in 0 .. #nSegments {
+        const lo = nElts * offset / nSegments;
+        const hi = nElts * (offset + 1) / nSegments;
+        ref segment = segments[(startIdx + offset) % here.maxTaskPar];
+        segment.acquire(STATUS_ADD);
+        segment.addElementsPtr(buffer + lo, hi - lo);
+        segment.releaseStatus();
+      }
+
+      c_free(buffer);
+      return nElts;
+    }
+
+    proc removeBulk(nElts : int) {
+      var dom = {0..#nElts};
+      var arr : [dom] eltType;
+      var nRemoved = 0;
+
+      // Drain as much as we need from each segment while holding its lock.
+      const startIdx = nextStartIdxDeq;
+      for offset in 0 .. #here.maxTaskPar {
+        if nRemoved == nElts then break;
+        ref segment = segments[(startIdx + offset) % here.maxTaskPar];
+        if segment.acquireIfNonEmpty(STATUS_REMOVE) {
+          const n = min(nElts - nRemoved, segment.nElems.read() : int);
+          segment.transferElements(c_ptrTo(arr[nRemoved]), n);
+          segment.releaseStatus();
+          nRemoved += n;
+        }
+      }
+
+      // Anything else has to be found one element at a time, possibly by
+      // stealing from other nodes.
+      while nRemoved < nElts {
+        var (hasElt, elt) = remove();
+        if !hasElt then break;
+        arr[nRemoved] = elt;
+        nRemoved += 1;
+      }
+
+      dom = {0..#nRemoved};
+      return arr;
+    }
+
+    /*
+      Moves 'n' elements (or as many as there are) from this node to the same
+      segments on node 'loc', splitting them across the segments. Each segment is
+      locked only while elements are copied into or out of it.
+    */
+    proc giveElements(n : int, loc : locale) {
+      const nSegments = here.maxTaskPar;
+      const pid = parentHandle.pid;
+      coforall segmentIdx in 0 .. #nSegments {
+        ref segment = segments[segmentIdx];
+        var want = n / nSegments + (if segmentIdx < n % nSegments then 1 else 0);
+        var buffer : c_ptr(eltType);
+        var nTaken = 0;
+
+        if want > 0 && segment.acquireIfNonEmpty(STATUS_BALANCE) {
+          nTaken = min(want, segment.nElems.read() : int);
+          buffer = c_malloc(eltType, nTaken);
+          segment.transferElements(buffer, nTaken);
+          segment.releaseStatus();
+        }
+
+        if nTaken > 0 {
+          const srcLocId = here.id;
+          on loc {
+            ref targetSegment = chpl_getPrivatizedCopy(parentHandle.type, pid).bag.segments[segmentIdx];
+            targetSegment.acquire(STATUS_BALANCE);
+            targetSegment.addElementsPtr(buffer, nTaken, srcLocId);
+            targetSegment.releaseStatus();
+          }
+          c_free(buffer);
+        }
+      }
+    }
+
     proc add(elt : eltType) : bool {
       var startIdx = nextStartIdxEnq : int;
       var phase = ADD_BEST_CASE;
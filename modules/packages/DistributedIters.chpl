@@ -67,10 +67,10 @@ config const infoDistributedIters:bool = false;
     the domain ``c``. Defaults to 1.
   :type parDim: int
 
-  :arg localeChunkSize: Chunk size to yield to each locale. Must be
-    nonnegative. If this argument has value 0, the iterator will use
-    an undefined heuristic in an attempt to choose a value that will
-    perform well.
+  :arg localeChunkSize: The smallest number of iterations a locale steals
+    from another locale at once. Must be nonnegative. If this argument has
+    value 0, the iterator uses ``chunkSize``. Larger values reduce the
+    number of steals between locales at the cost of load balance.
   :type localeChunkSize: `int`
 
   :arg coordinated: If true (and multi-locale), then have the locale invoking
@@ -88,11 +88,14 @@ config const infoDistributedIters:bool = false;
   OpenMP.
 
   Given an input range (or domain) ``c``, each locale (except the calling
-  locale, if coordinated is true) receives chunks of size ``localeChunkSize``
-  from ``c`` (or the remaining iterations if there are fewer than
-  ``localeChunkSize``). Each locale then distributes sub-chunks of size
-  ``chunkSize`` as tasks, using the ``dynamic`` iterator from the
-  ``DynamicIters`` module.
+  locale, if coordinated is true) starts with an equal part of ``c``, which
+  it splits evenly between its tasks. Each task takes chunks of size
+  ``chunkSize`` from its own part (or the remaining iterations if there are
+  fewer than ``chunkSize``). A task that runs out of work steals half of the
+  remaining iterations of another task on the same locale, and only when
+  the whole locale is out of work does it steal from another locale. Chunks
+  are therefore handed out without communication, and without any locale
+  serving the requests of all the others.
 
   Available for serial and zippered contexts.
 */
@@ -194,7 +197,6 @@ where tag == iterKind.leader
     else
     {
       const numWorkerLocales = workerLocales.size;
-      const denseRangeHigh:int = denseRange.high;
       const masterLocale = here.locale;
 
       const potentialWorkerLocales =
@@ -223,62 +225,28 @@ where tag == iterKind.leader
                 " ]");
       }
 
+      // Work moves between locales in pieces of at least this size.
+      const minStealSize = max(localeChunkSize, chunkSize);
+
       var localeTimes:[0..#numLocales]real;
       var totalTime:Timer;
       if timeDistributedIters then totalTime.start();
 
-      // The dynamic iterator stage (determines next subrange index and size).
-      var dynamicStageCount:atomic int;
-
-      coforall L in actualWorkerLocales
-      with (ref dynamicStageCount, ref localeTimes)
-      do on L
+      for taskRange in hierarchicalChunks(tag=iterKind.leader,
+                                          denseRange,
+                                          chunkSize,
+                                          numTasks,
+                                          minStealSize,
+                                          guided=false,
+                                          actualWorkerLocales,
+                                          localeTimes)
       {
-        // TODO: Find a better heuristic backed by experimentation
-        const computedSize = if localeChunkSize == 0
-                             then denseRange.size / actualWorkerLocales.size / 10
-                             else localeChunkSize;
-        // localeChunkSize should not be less than chunkSize
-        const maxSize = max(computedSize, chunkSize);
-        const actualLocaleChunkSize = min(maxSize, denseRange.size);
-        var localeTime:Timer;
-        if timeDistributedIters then localeTime.start();
-
-        var localeStage:int = dynamicStageCount.fetchAdd(1);
-        var localeRange:cType = dynamicSubrange(denseRange,
-                                                actualLocaleChunkSize,
-                                                localeStage);
-        while localeRange.low <= denseRangeHigh
-        {
-          const denseLocaleRange:cType = densify(localeRange, localeRange);
-          for denseTaskRangeTuple in DynamicIters.dynamic(tag=iterKind.leader,
-                                                          localeRange,
-                                                          chunkSize,
-                                                          numTasks)
-          {
-            const taskRange:cType = unDensify(denseTaskRangeTuple(1),
-                                              localeRange);
-            if debugDistributedIters
-            then writeln("DistributedIters: Dynamic iterator (leader): ",
-                         here.locale, ": yielding ", unDensify(taskRange,c),
-                         " (", taskRange.length,
-                         "/", localeRange.length,
-                         " locale-owned of ", iterCount,
-                         " total) as ", taskRange);
-            yield (taskRange,);
-          }
-
-          localeStage = dynamicStageCount.fetchAdd(1);
-          localeRange = dynamicSubrange(denseRange,
-                                        actualLocaleChunkSize,
-                                        localeStage);
-        }
-
-        if timeDistributedIters then
-        {
-          localeTime.stop();
-          localeTimes[here.id] = localeTime.elapsed();
-        }
+        if debugDistributedIters
+        then writeln("DistributedIters: Dynamic iterator (leader): ",
+                     here.locale, ": yielding ", unDensify(taskRange(1),c),
+                     " (", taskRange(1).length,
+                     " of ", iterCount, " total) as ", taskRange(1));
+        yield taskRange;
       }
 
       if timeDistributedIters then
@@ -356,14 +324,13 @@ where tag == iterKind.follower
   OpenMP.
 
   Given an input range (or domain) ``c``, each locale (except the calling
-  locale, if coordinated is true) receives chunks of approximately
-  exponentially decreasing size, until the remaining iterations reaches a
-  minimum value, ``minChunkSize``, or there are no remaining iterations in
-  ``c``. The chunk size is the number of unassigned iterations divided by the
-  number of locales. Each locale then distributes sub-chunks as tasks, where
-  each sub-chunk size is the number of unassigned local iterations divided by
-  the number of tasks, ``numTasks``, and decreases approximately exponentially
-  to 1. The splitting strategy is therefore adaptive.
+  locale, if coordinated is true) starts with an equal part of ``c``, which
+  it splits evenly between its tasks. Each task takes chunks of half of its
+  remaining iterations, so the chunk size decreases approximately
+  exponentially until it reaches ``minChunkSize``. The splitting strategy is
+  therefore adaptive. As in :iter:`distributedDynamic`, a task that runs out
+  of work steals from another task on the same locale, and only steals from
+  other locales when the whole locale is out of work.
 
   Available for serial and zippered contexts.
 */
@@ -457,7 +424,6 @@ where tag == iterKind.leader
     else
     {
       const numWorkerLocales = workerLocales.size;
-      const denseRangeHigh:int = denseRange.high;
       const masterLocale = here.locale;
 
       const potentialWorkerLocales =
@@ -474,9 +440,6 @@ where tag == iterKind.leader
                                   else [masterLocale];
       const numActualWorkerLocales = actualWorkerLocales.size;
 
-      // The guided iterator stage (determines next subrange index and size).
-      var guidedStageCount:atomic int;
-
       if infoDistributedIters then
       {
         const actualWorkerLocaleIds = [L in actualWorkerLocales] L.id:string;
@@ -496,47 +459,21 @@ where tag == iterKind.leader
       var totalTime:Timer;
       if timeDistributedIters then totalTime.start();
 
-      coforall L in actualWorkerLocales
-      with (ref guidedStageCount, ref localeTimes)
-      do on L
+      for taskRange in hierarchicalChunks(tag=iterKind.leader,
+                                          denseRange,
+                                          minChunkSize,
+                                          numTasks,
+                                          minChunkSize,
+                                          guided=true,
+                                          actualWorkerLocales,
+                                          localeTimes)
       {
-        var localeTime:Timer;
-        if timeDistributedIters then localeTime.start();
-
-        var localeStage:int = guidedStageCount.fetchAdd(1);
-        var localeRange:cType = guidedSubrange(denseRange,
-                                               numActualWorkerLocales,
-                                               localeStage);
-        while localeRange.high <= denseRangeHigh
-        {
-          const denseLocaleRange:cType = densify(localeRange, localeRange);
-          for denseTaskRangeTuple in DynamicIters.guided(tag=iterKind.leader,
-                                                         localeRange,
-                                                         numTasks)
-          {
-            const taskRange:cType = unDensify(denseTaskRangeTuple(1),
-                                              localeRange);
-            if debugDistributedIters
-            then writeln("DistributedIters: Guided iterator (leader): ",
-                         here.locale, ": yielding ", unDensify(taskRange,c),
-                         " (", taskRange.length,
-                         "/", localeRange.length,
-                         " locale-owned of ", iterCount,
-                         " total) as ", taskRange);
-            yield (taskRange,);
-          }
-
-          localeStage = guidedStageCount.fetchAdd(1);
-          localeRange = guidedSubrange(denseRange,
-                                       numActualWorkerLocales,
-                                       localeStage);
-        }
-
-        if timeDistributedIters then
-        {
-          localeTime.stop();
-          localeTimes[here.id] = localeTime.elapsed();
-        }
+        if debugDistributedIters
+        then writeln("DistributedIters: Guided iterator (leader): ",
+                     here.locale, ": yielding ", unDensify(taskRange(1),c),
+                     " (", taskRange(1).length,
+                     " of ", iterCount, " total) as ", taskRange(1));
+        yield taskRange;
       }
 
       if timeDistributedIters then
@@ -582,82 +519,212 @@ where tag == iterKind.follower
   Helpers.
 */
 
-// Dynamic subrange calculation.
+// Hierarchical work distribution.
 /*
-  :arg c: The range from which to retrieve a dynamic subrange.
-  :type c: `range(?)`
+  The iterations that one worker locale has left, as one range per task.
+  Each task takes chunks from the front of its own range, so tasks only
+  contend for a lock when one of them steals from the back of another's.
+*/
+pragma "no doc"
+class DistributedWorkPool
+{
+  type rType;
+  const numTasks:int;
+  var work:[0..#numTasks] rType;
+  // The length of each range in work, readable without taking its lock.
+  var left:[0..#numTasks] atomic int;
+  var locks:[0..#numTasks] vlock;
+
+  proc init(type rType, r:rType, numTasks:int)
+  {
+    this.rType = rType;
+    this.numTasks = numTasks;
+    this.complete();
+    for tid in 0..#numTasks
+    {
+      work[tid] = evenSubrange(r, numTasks, tid);
+      left[tid].write(work[tid].length);
+    }
+  }
 
-  :arg chunkSize: The chunk size. Must be positive.
-  :type chunkSize: `int`
+  /*
+    Take the next chunk from the front of task ``tid``'s range: ``chunkSize``
+    iterations, or (if guided) half of the range but at least
+    ``chunkSize``.
+  */
+  proc take(tid:int, chunkSize:int, guided:bool):rType
+  {
+    locks[tid].lock();
+    const r = work[tid];
+    const len = r.length;
+    const size = min(len, if guided then max(len / 2, chunkSize)
+                                    else chunkSize);
+    const chunk:rType = r # size;
+    work[tid] = r # (size - len);
+    left[tid].write(len - size);
+    locks[tid].unlock();
+    return chunk;
+  }
 
-  :arg stage: The number of dynamic subranges to skip before returning a
-    dynamic subrange.
-  :type stage: `int`
+  /*
+    Steal the back half of the largest range left in this pool, or all of
+    it if it has no more than ``minSize`` iterations. Returns an empty range
+    once no task has work left.
+  */
+  proc steal(minSize:int):rType
+  {
+    while true
+    {
+      var victim = -1, most = 0;
+      for tid in 0..#numTasks
+      {
+        const l = left[tid].read();
+        if l > most then (victim, most) = (tid, l);
+      }
+      if victim == -1 then break;
+
+      locks[victim].lock();
+      const r = work[victim];
+      const len = r.length;
+      const size = if len <= minSize then len else max(len / 2, minSize);
+      const stolen:rType = r # -size;
+      work[victim] = r # (len - size);
+      left[victim].write(len - size);
+      locks[victim].unlock();
+
+      // Otherwise the victim emptied its range since we looked; try again.
+      if size > 0 then return stolen;
+    }
+    var empty:rType;
+    return empty;
+  }
 
-  :returns: A subrange of ``c``.
+  // Give task ``tid`` a new range to work on, once its own is empty.
+  proc give(tid:int, r:rType)
+  {
+    locks[tid].lock();
+    work[tid] = r;
+    left[tid].write(r.length);
+    locks[tid].unlock();
+  }
+}
 
-  This function takes a range, a chunk size, and a stage, and simulates
-  performing OpenMP's dynamic schedule on the range with the given chunk
-  size until reaching the given stage. It then returns the subrange that the
-  dynamic schedule would have produced at that point.
+/*
+  :arg denseRange: The dense range to split.
+  :arg chunkSize: The chunk size for each task, or the smallest chunk size if
+    ``guided`` is true.
+  :arg numTasks: The number of tasks to use on each locale, or 0 for the
+    value indicated by ``dataParTasksPerLocale``.
+  :arg minStealSize: The fewest iterations to move between locales at once.
+  :arg guided: Whether tasks take half of their remaining iterations at a
+    time rather than ``chunkSize``.
+  :arg workerLocales: The locales to run on.
+  :arg localeTimes: The time each locale spent, if ``timeDistributedIters``.
+
+  This iterator yields the chunks of ``denseRange`` (as 1-tuples) from tasks
+  on each of ``workerLocales``. The range is first split evenly between the
+  locales, and each locale's part between its tasks. A task that runs out
+  of work steals half of the largest range of another task on its locale.
+  Only when the whole locale is out of work does it steal from other
+  locales, visiting them in turn starting from its neighbor. This way most
+  chunks are handed out without any communication, and no locale becomes
+  a hotspot.
 */
-private proc dynamicSubrange(c:range(?),
-                             chunkSize:int,
-                             stage:int)
+private iter hierarchicalChunks(param tag:iterKind,
+                                denseRange:range(?),
+                                chunkSize:int,
+                                numTasks:int,
+                                minStealSize:int,
+                                guided:bool,
+                                workerLocales,
+                                ref localeTimes:[]real)
+where tag == iterKind.leader
 {
-  const low:int = (c.low + (stage * chunkSize));
-  const potentialHigh:int = (low + (chunkSize - 1));
-  const high:int = min(potentialHigh, c.high);
-  const subrange:c.type = (low..high);
-  return subrange;
+  type rType = denseRange.type;
+  const numWorkerLocales = workerLocales.size;
+  const workerLocaleIdxs = 0..#numWorkerLocales;
+
+  // Seed a pool on each locale with its part of the range.
+  var pools:[workerLocaleIdxs] unmanaged DistributedWorkPool(rType);
+  coforall (L, locIdx) in zip(workerLocales, workerLocaleIdxs)
+  with (ref pools)
+  do on L
+  {
+    const nTasks = if numTasks > 0 then numTasks
+                   else if dataParTasksPerLocale == 0 then here.maxTaskPar
+                   else dataParTasksPerLocale;
+    pools[locIdx] = new unmanaged DistributedWorkPool(rType,
+        evenSubrange(denseRange, numWorkerLocales, locIdx), nTasks);
+  }
+
+  coforall (L, locIdx) in zip(workerLocales, workerLocaleIdxs)
+  with (ref localeTimes)
+  do on L
+  {
+    var localeTime:Timer;
+    if timeDistributedIters then localeTime.start();
+
+    const localPools = pools;
+    const myPool = localPools[locIdx];
+
+    coforall tid in 0..#myPool.numTasks
+    {
+      while true
+      {
+        const taskRange = myPool.take(tid, chunkSize, guided);
+        if taskRange.length > 0
+        {
+          yield (taskRange,);
+          continue;
+        }
+
+        // Out of work: steal from this locale first, then from the others.
+        var stolen = myPool.steal(chunkSize);
+        for i in 1..numWorkerLocales-1
+        {
+          if stolen.length > 0 then break;
+          const victimPool = localPools[(locIdx + i) % numWorkerLocales];
+          on victimPool do stolen = victimPool.steal(minStealSize);
+        }
+        if stolen.length == 0 then break;
+        myPool.give(tid, stolen);
+      }
+    }
+
+    if timeDistributedIters then
+    {
+      localeTime.stop();
+      localeTimes[here.id] = localeTime.elapsed();
+    }
+  }
+
+  coforall pool in pools do on pool do delete pool;
 }
 
-// Guided subrange calculation.
+// Even subrange calculation.
 /*
-  :arg c: The range from which to retrieve a guided subrange.
+  :arg c: The range to split.
   :type c: `range(?)`
 
-  :arg workerCount: The number of workers (locales, tasks) to assume are
-    working on ``c``. This (along with stage) determines the subrange length.
-  :type workerCount: `int`
+  :arg numParts: The number of parts to split ``c`` into.
+  :type numParts: `int`
 
-  :arg stage: The number of guided subranges to skip before returning a
-    guided subrange.
-  :type stage: `int`
-
-  :arg minChunkSize: The smallest allowable chunk size. Must be positive.
-    Defaults to 1.
-  :type minChunkSize: `int`
+  :arg part: Which part to return, from 0 to ``numParts-1``.
+  :type part: `int`
 
   :returns: A subrange of ``c``.
 
-  This function takes a range, a worker count, and a stage, and simulates
-  performing OpenMP's guided schedule on the range with the given worker
-  count until reaching the given stage. It then returns the subrange that the
-  guided schedule would have produced at that point. The simulation overhead
-  is insignificant.
+  This function splits a range into ``numParts`` consecutive parts whose
+  lengths differ by at most one, and returns one of them.
 */
-private proc guidedSubrange(c:range(?),
-                            workerCount:int,
-                            stage:int,
-                            minChunkSize:int=1)
+private proc evenSubrange(c:range(?),
+                          numParts:int,
+                          part:int)
 {
-  assert(workerCount > 0, ("DistributedIters: guidedSubrange: "
-                           + "'workerCount' must be positive"));
-  const cLength = c.length;
-  var low:int = c.low;
-  var chunkSize:int = (cLength / workerCount);
-  var remainder:int = (cLength - chunkSize);
-  for unused in (1..#stage)
-  {
-    low += chunkSize;
-    chunkSize = (remainder / workerCount);
-    chunkSize = if (chunkSize >= minChunkSize)
-                then chunkSize
-                else minChunkSize;
-    remainder -= chunkSize;
-  }
-  const subrange:c.type = (low..#chunkSize);
+  const len = c.length;
+  const low:int = (len * part) / numParts;
+  const high:int = (len * (part + 1)) / numParts;
+  const subrange:c.type = (c # high) # (low - high);
   return subrange;
 }
 
@@ -532,6 +532,11 @@ proc _array.elementDiv(A: [?Adom]) where isDenseArr(A) && isDenseArr(this) {
       Dense matrix-matrix and matrix-vector multiplication will utilize the
       :mod:`BLAS` module for improved performance, if available. Compile with
       ``--set blasImpl=none`` to opt out of the :mod:`BLAS` implementation.
+
+    .. note::
+
+      Two ``Block`` distributed matrices can also be multiplied.  The result
+      is ``Block`` distributed over the same locales as ``A``.
 */
 proc dot(A: [?Adom] ?eltType, B: [?Bdom] eltType) where isDenseArr(A) && isDenseArr(B) {
   // vector-vector
@@ -542,6 +547,13 @@ proc dot(A: [?Adom] ?eltType, B: [?Bdom] eltType) where isDenseArr(A) && isDense
     return matMult(A, B);
 }
 
+pragma "no doc"
+/* Block distributed matrix-matrix multiplication */
+proc dot(A: [?Adom] ?eltType, B: [?Bdom] eltType)
+  where isBlockArr(A) && isBlockArr(B) && Adom.rank == 2 && Bdom.rank == 2 {
+  return _matmatMultSUMMA(A, B);
+}
+
 /* Compute the dot-product
 
   .. note::
@@ -655,6 +667,27 @@ proc outer(A: [?Adom] ?eltType, B: [?Bdom] eltType) {
 }
 
 
+/*
+  Block sizes for the native matrix-matrix multiplication.  Each task
+  computes a ``gemmRowBlock x gemmColBlock`` block of C, ``gemmInnerBlock``
+  columns of A at a time.  The panels of A and B are copied into buffers laid
+  out so that the micro-kernel reads both sequentially while it keeps a
+  ``gemmMR x gemmNR`` tile of C in registers.
+*/
+private param gemmMR = 4,
+              gemmNR = 4,
+              gemmRowBlock = 64,
+              gemmColBlock = 256,
+              gemmInnerBlock = 256;
+
+
+/* The ``count`` indices of ``r`` starting at position ``first`` */
+private inline proc _orderSlice(r: range(?), first, count) {
+  const n = min(count, r.size - first);
+  return (r # (first + n)) # -n;
+}
+
+
 pragma "no doc"
 /* Generic matrix-vector multiplication. */
 proc _matvecMult(A: [?Adom] ?eltType, X: [?Xdom] eltType, trans=false)
@@ -668,17 +701,31 @@ proc _matvecMult(A: [?Adom] ?eltType, X: [?Xdom] eltType, trans=false)
 
   var Y: [Ydom] eltType;
 
-  // naive algorithm
+  const (rows, cols) = Adom.dims();
   if !trans {
     if Adom.shape(2) != Xdom.shape(1) then
       halt("Mismatched shape in matrix-vector multiplication");
-    forall i in Ydom do
-      Y[i] = + reduce (A[i,..]*X[..]);
+    // Each task computes whole rows, walking A in row-major order
+    forall i in rows {
+      var acc: eltType;
+      for (j, xj) in zip(cols, Xdom.dim(1)) do
+        acc += A[i, j] * X[xj];
+      Y[i] = acc;
+    }
   } else {
     if Adom.shape(1) != Xdom.shape(1) then
       halt("Mismatched shape in matrix-vector multiplication");
-    forall i in Ydom do
-      Y[i] = + reduce (A[.., i]*X[..]);
+    // Each task owns a block of columns of A and sweeps down the rows, so
+    // A is still read in row-major order and no reduction is needed
+    const colBlocks = (cols.size + gemmColBlock - 1) / gemmColBlock;
+    forall jb in 0..#colBlocks {
+      const myCols = _orderSlice(cols, jb*gemmColBlock, gemmColBlock);
+      for (i, xi) in zip(rows, Xdom.dim(1)) {
+        const x = X[xi];
+        for j in myCols do
+          Y[j] += A[i, j] * x;
+      }
+    }
   }
 
   return Y;
@@ -692,13 +739,134 @@ proc _matmatMult(A: [?Adom] ?eltType, B: [?Bdom] eltType)
 {
   if Adom.rank != 2 || Bdom.rank != 2 then
     compilerError("Rank sizes are not 2 and 2");
+  if Adom.shape(2) != Bdom.shape(1) then
+    halt("Mismatched shape in matrix-matrix multiplication");
 
   var C: [Adom.dim(1), Bdom.dim(2)] eltType;
+  _gemmAccumulate(A, B, C);
+  return C;
+}
 
-  // naive algorithm
-  forall (i,j) in C.domain do
-    C[i,j] = + reduce (A[i,..]*B[..,j]);
 
+/* Computes ``C += A * B`` for local, dense matrices of matching shapes */
+private proc _gemmAccumulate(A: [?Adom] ?eltType, B: [?Bdom] eltType,
+                             ref C: [?Cdom] eltType) {
+  param MR = gemmMR, NR = gemmNR;
+  const (Ar, Ac) = Adom.dims(),
+        Bc = Bdom.dim(2),
+        (Cr, Cc) = Cdom.dims();
+  const m = Cr.size, n = Cc.size, k = Ac.size;
+  const rowBlocks = (m + gemmRowBlock - 1) / gemmRowBlock,
+        colBlocks = (n + gemmColBlock - 1) / gemmColBlock;
+
+  forall (ib, jb) in {0..#rowBlocks, 0..#colBlocks} {
+    const myRows = _orderSlice(Cr, ib*gemmRowBlock, gemmRowBlock),
+          myCols = _orderSlice(Cc, jb*gemmColBlock, gemmColBlock);
+    const mb = myRows.size, nb = myCols.size;
+    const rowPanels = (mb + MR - 1) / MR,
+          colPanels = (nb + NR - 1) / NR;
+
+    // Padding in the last panels is never written, so it stays zero
+    var Ap: [0..#rowPanels*MR*gemmInnerBlock] eltType,
+        Bp: [0..#colPanels*NR*gemmInnerBlock] eltType;
+
+    for p0 in 0..#k by gemmInnerBlock {
+      const kb = min(gemmInnerBlock, k - p0);
+      const Ak = _orderSlice(Ac, p0, kb),
+            Bk = _orderSlice(Bdom.dim(1), p0, kb);
+
+      // Pack MR-row panels of A, stored column by column
+      for (r, i) in zip(0..#mb, _orderSlice(Ar, ib*gemmRowBlock, mb)) {
+        const base = (r / MR) * kb * MR + r % MR;
+        for (kk, j) in zip(0..#kb, Ak) do
+          Ap[base + kk*MR] = A[i, j];
+      }
+
+      // Pack NR-column panels of B, stored row by row
+      for (kk, i) in zip(0..#kb, Bk) {
+        for (c, j) in zip(0..#nb, _orderSlice(Bc, jb*gemmColBlock, nb)) do
+          Bp[(c / NR) * kb * NR + kk*NR + c % NR] = B[i, j];
+      }
+
+      for jp in 0..#colPanels {
+        const bBase = jp * kb * NR;
+        for ip in 0..#rowPanels {
+          const aBase = ip * kb * MR;
+
+          // Micro-kernel: an MR x NR outer product per step of the inner
+          // dimension, accumulated in a tuple the back-end keeps in
+          // registers
+          var acc: (MR*NR)*eltType;
+          for kk in 0..#kb {
+            const a = aBase + kk*MR, b = bBase + kk*NR;
+            for param r in 0..MR-1 {
+              const ar = Ap[a + r];
+              for param c in 0..NR-1 do
+                acc(r*NR + c + 1) += ar * Bp[b + c];
+            }
+          }
+
+          for (i, r) in zip(_orderSlice(myRows, ip*MR, MR), 0..) do
+            for (j, c) in zip(_orderSlice(myCols, jp*NR, NR), 0..) do
+              C[i, j] += acc(r*NR + c + 1);
+        }
+      }
+    }
+  }
+}
+
+
+pragma "no doc"
+/* Returns ``true`` if the array is distributed with ``Block`` */
+private proc isBlockArr(A: []) param {
+  use BlockDist;
+  proc isBlock(D: Block) param return true;
+  proc isBlock(D) param return false;
+  return isBlock(A.domain.dist._value);
+}
+
+
+pragma "no doc"
+/*
+  Matrix-matrix multiplication of ``Block`` distributed matrices.
+
+  This follows SUMMA: C is distributed over the same locales as A, and each
+  locale accumulates its block of C from one panel of columns of A and the
+  matching panel of rows of B at a time.  Each locale copies the pieces of
+  those panels it needs into local buffers with bulk transfers, then
+  multiplies them locally.
+*/
+private proc _matmatMultSUMMA(A: [?Adom] ?eltType, B: [?Bdom] eltType) {
+  use BlockDist;
+  if Adom.rank != 2 || Bdom.rank != 2 then
+    compilerError("Rank sizes are not 2 and 2");
+  if Adom.shape(2) != Bdom.shape(1) then
+    halt("Mismatched shape in matrix-matrix multiplication");
+
+  const Cspace = {Adom.dim(1), Bdom.dim(2)};
+  const Cdom = Cspace dmapped Block(boundingBox=Cspace,
+                                    targetLocales=A.targetLocales());
+  var C: [Cdom] eltType;
+
+  const k = Adom.dim(2).size;
+  coforall loc in C.targetLocales() do on loc {
+    const myC = C.localSubdomain();
+    if myC.size > 0 {
+      const (myRows, myCols) = myC.dims();
+      var Cloc: [myC] eltType;
+      for p0 in 0..#k by gemmInnerBlock {
+        const Ak = _orderSlice(Adom.dim(2), p0, gemmInnerBlock),
+              Bk = _orderSlice(Bdom.dim(1), p0, gemmInnerBlock);
+        const Apanel: [myRows, Ak] eltType = A[myRows, Ak],
+              Bpanel: [Bk, myCols] eltType = B[Bk, myCols];
+        if usingBLAS && BLAS.isBLASType(eltType) then
+          BLAS.gemm(Apanel, Bpanel, Cloc, 1:eltType, 1:eltType);
+        else
+          _gemmAccumulate(Apanel, Bpanel, Cloc);
+      }
+      C[myC] = Cloc;
+    }
+  }
   return C;
 }
 
@@ -1657,12 +1825,7 @@ module Sparse {
     if !trans {
       if Adom.shape(2) != Xdom.shape(1) then
         halt("Mismatched shape in matrix-vector multiplication");
-        // TODO: Loop over non-zero rows only
-        forall i in Adom.dim(1) {
-          for j in Adom.dimIter(2, i) {
-            Y[i] += A[i, j] * X[j];
-          }
-        }
+      _csrmatvecBalanced(A, X, Y);
     } else {
       if Adom.shape(1) != Xdom.shape(1) then
         halt("Mismatched shape in matrix-vector multiplication");
@@ -1679,6 +1842,86 @@ module Sparse {
     return Y;
   }
 
+  pragma "no doc"
+  /* CSR matrix-vector multiplication, ``Y = A * X``.
+
+     The non-zeros of A are split evenly between the tasks, even when that
+     splits a row between tasks, so a few long rows can not leave most tasks
+     idle.  Each task computes the rows it owns entirely, and returns its
+     partial sums for the rows at either end of its range, which are added
+     in afterwards.
+  */
+  private proc _csrmatvecBalanced(A: [?Adom] ?eltType, X: [?Xdom] eltType,
+                                  ref Y: [?Ydom] eltType) {
+    /* Aliases for readability */
+    proc _array.indPtr ref return this.dom.startIdx;
+    proc _array.indices ref return this.dom.idx;
+
+    const rows = Adom.dim(1);
+    if rows.size == 0 then return;
+
+    const nnzLo = A.indPtr[rows.low],
+          nnz = A.indPtr[rows.high+1] - nnzLo;
+    const numTasks = max(1, min(nnz, _sparseTasks()));
+
+    var firstRow, lastRow: [0..#numTasks] Adom.idxType = rows.low - 1;
+    var firstSum, lastSum: [0..#numTasks] eltType;
+
+    coforall t in 0..#numTasks {
+      const lo = nnzLo + nnz * t / numTasks,
+            hi = nnzLo + nnz * (t+1) / numTasks;
+
+      // The row holding non-zero 'lo': the last row starting at or before it
+      var row = _lastRowStartingBy(A.indPtr, rows, lo);
+      var k = lo;
+      while k < hi {
+        const rowEnd = min(A.indPtr[row+1], hi);
+        var sum: eltType;
+        for kk in k..rowEnd-1 do
+          sum += A.data[kk] * X[A.indices[kk]];
+
+        if k > A.indPtr[row] || rowEnd < A.indPtr[row+1] {
+          // This row is shared with another task
+          if k == lo {
+            firstRow[t] = row;
+            firstSum[t] = sum;
+          } else {
+            lastRow[t] = row;
+            lastSum[t] = sum;
+          }
+        } else {
+          Y[row] = sum;
+        }
+        k = rowEnd;
+        row += 1;
+      }
+    }
+
+    for t in 0..#numTasks {
+      if firstRow[t] >= rows.low then Y[firstRow[t]] += firstSum[t];
+      if lastRow[t] >= rows.low then Y[lastRow[t]] += lastSum[t];
+    }
+  }
+
+  pragma "no doc"
+  /* The last row in ``rows`` whose first non-zero is at or before ``k`` */
+  private proc _lastRowStartingBy(const ref indPtr, rows: range, k) {
+    var lo = rows.low, hi = rows.high;
+    while lo < hi {
+      const mid = lo + (hi - lo + 1) / 2;
+      if indPtr[mid] <= k then lo = mid;
+      else hi = mid - 1;
+    }
+    return lo;
+  }
+
+  pragma "no doc"
+  /* Number of tasks to use for sparse operations on this locale */
+  private proc _sparseTasks() {
+    return if dataParTasksPerLocale == 0 then here.maxTaskPar
+           else dataParTasksPerLocale;
+  }
+
   pragma "no doc"
   /* Sparse matrix-matrix multiplication.
 
@@ -1691,6 +1934,12 @@ module Sparse {
 
       https://link.springer.com/article/10.1007/BF02070824
 
+     The rows of C are computed in parallel, following Gustavson's
+     algorithm: a symbolic pass counts the non-zeros of each row, a
+     parallel scan turns the counts into row pointers, and a numeric pass
+     fills in each row.  Rows are divided between tasks so that each does
+     about the same number of multiplications, and each task has its own
+     sparse accumulator.
   */
   proc _csrmatmatMult(A: [?ADom] ?eltType, B: [?BDom] eltType) where isCSArr(A) && isCSArr(B) {
     type idxType = ADom.idxType;
@@ -1698,16 +1947,30 @@ module Sparse {
     const (M, K1) = A.shape,
           (K2, N) = B.shape;
 
+    // Multiplications needed for each row of C
+    var rowWork: [1..M] int;
+    forall i in 1..M {
+      var work = 0;
+      for jj in A.dom.startIdx[i]..A.dom.startIdx[i+1]-1 {
+        const j = A.dom.idx[jj];
+        work += B.dom.startIdx[j+1] - B.dom.startIdx[j];
+      }
+      rowWork[i] = work;
+    }
+    const maxRowWork = if M > 0 then max reduce rowWork else 0;
+    _prefixSum(rowWork);
+    const bounds = _splitRows(rowWork, _sparseTasks());
+
     // major axis
     var indPtr: [1..M+1] idxType;
 
-    pass1(A, B, indPtr);
+    pass1(A, B, indPtr, bounds, maxRowWork);
 
-    const nnz = indPtr[indPtr.domain.last];
+    const nnz = indPtr[indPtr.domain.last] - 1;
     var indices: [1..nnz] idxType;
     var data: [1..nnz] eltType;
 
-    pass2(A, B, indPtr, indices, data);
+    pass2(A, B, indPtr, indices, data, bounds, maxRowWork);
 
     var C = CSRMatrix((M, N), data, indices, indPtr);
 
@@ -1718,114 +1981,234 @@ module Sparse {
     return C;
   }
 
-
   pragma "no doc"
-  /* Populate indPtr and total nnz (last element of indPtr) */
-  proc pass1(ref A: [?ADom] ?eltType, ref B: [?BDom] eltType, ref indPtr) {
-    // TODO: Parallelize - mask -> atomic ints,
-    //                   - Write a scan to compute idxPtr in O(log(n))
+  /* Replace each element of ``X`` with the sum of the elements up to and
+     including it, using several tasks */
+  private proc _prefixSum(ref X: [?D]) {
+    use RangeChunk;
+
+    const rng = D.dim(1);
+    const numTasks = max(1, min(_sparseTasks(), rng.size));
+    var partial: [0..#numTasks] X.eltType;
+
+    coforall t in 0..#numTasks with (ref X) {
+      var sum: X.eltType;
+      for i in chunk(rng, numTasks, t) {
+        sum += X[i];
+        X[i] = sum;
+      }
+      partial[t] = sum;
+    }
 
-    /* Aliases for readability */
-    proc _array.indPtr ref return this.dom.startIdx;
-    proc _array.indices ref return this.dom.idx;
+    for t in 1..numTasks-1 do partial[t] += partial[t-1];
 
-    const (M, K1) = A.shape,
-          (K2, N) = B.shape;
-    type idxType = ADom.idxType;
-    var mask: [1..N] idxType;
-    indPtr[1] = 1;
-    var nnz = 1: idxType;
+    coforall t in 1..numTasks-1 with (ref X) {
+      const offset = partial[t-1];
+      for i in chunk(rng, numTasks, t) do X[i] += offset;
+    }
+  }
 
-    // Rows of C
-    for i in 1..M {
-      var row_nnz = 0;
-      const Arange = A.indPtr[i]..A.indPtr[i+1]-1;
-      // Row pointers of A
-      for jj in Arange {
-        // Column index of A
-        const j = A.indices[jj];
-        const Brange = B.indPtr[j]..B.indPtr[j+1]-1;
-        // Row pointers of B
-        for kk in Brange {
-          // Column index of B
-          var k = B.indices[kk];
-          if mask[k] != i {
-            mask[k] = i;
-            row_nnz += 1;
-          }
-        }
+  pragma "no doc"
+  /*
+    Split rows ``cumWork.domain`` into ``numTasks`` contiguous chunks with
+    about the same amount of work, where ``cumWork[i]`` is the total work of
+    the rows up to and including ``i``.  Chunk ``t`` is
+    ``bounds[t]..bounds[t+1]-1``.
+  */
+  private proc _splitRows(const ref cumWork: [?D] int, numTasks: int) {
+    const rows = D.dim(1);
+    var bounds: [0..numTasks] int;
+    bounds[0] = rows.low;
+    bounds[numTasks] = rows.high + 1;
+    if rows.size == 0 then return bounds;
+
+    const total = cumWork[rows.high];
+    forall t in 1..numTasks-1 {
+      // The first row whose preceding rows do at least t/numTasks of the
+      // work
+      const target = total / numTasks * t + total % numTasks * t / numTasks;
+      var lo = rows.low, hi = rows.high + 1;
+      while lo < hi {
+        const mid = (lo + hi) / 2;
+        const before = if mid == rows.low then 0 else cumWork[mid-1];
+        if before >= target then hi = mid;
+        else lo = mid + 1;
       }
-
-      nnz = nnz + row_nnz;
-      indPtr[i+1] = nnz;
+      bounds[t] = lo;
     }
+    return bounds;
   }
 
   pragma "no doc"
-  /* Populate indices and data */
-  proc pass2(ref A: [?ADom] ?eltType, ref B: [?BDom] eltType, ref indPtr, ref indices, ref data) {
-    // TODO: Parallelize - next, sums -> task-private stacks
+  /* A dense accumulator is used when the longest row of C could reach at
+     least 1/denseAccumulatorRatio of its columns */
+  private param denseAccumulatorRatio = 8;
 
+  pragma "no doc"
+  /*
+    Compute the rows ``rows`` of C.  In the symbolic pass
+    (``numeric=false``), ``indPtr[i+1]`` is set to the number of non-zeros in
+    row ``i``.  In the numeric pass, the non-zeros of row ``i`` are stored
+    starting at ``indPtr[i]``.
+
+    When C is narrow, the accumulator is dense, with one entry per column of
+    C.  Otherwise it is an open addressing hash table sized for the longest
+    row, so each task's accumulator stays small when C is very wide.  In
+    both cases, the non-zeros of a row are stored in the reverse of the
+    order their columns are first reached.
+  */
+  private proc _spgemmRows(A: [?ADom] ?eltType, B: [?BDom] eltType,
+                           rows: range, N: int, maxRowWork: int,
+                           param numeric: bool,
+                           ref indPtr, ref indices, ref data) {
     /* Aliases for readability */
     proc _array.indPtr ref return this.dom.startIdx;
     proc _array.indices ref return this.dom.idx;
 
     type idxType = ADom.idxType;
 
-    const (M, K1) = A.shape,
-          (K2, N) = B.shape;
-
-    const cols = {1..N};
-
-    var next: [cols] idxType = -1,
-        sums: [cols] eltType;
+    if rows.size == 0 then return;
+
+    if maxRowWork * denseAccumulatorRatio >= N {
+      if !numeric {
+        // Dense accumulator, marking the columns seen in row i with i
+        var mask: [1..N] idxType;
+
+        for i in rows {
+          var length = 0;
+          for jj in A.indPtr[i]..A.indPtr[i+1]-1 {
+            const j = A.indices[jj];
+            for kk in B.indPtr[j]..B.indPtr[j+1]-1 {
+              const k = B.indices[kk];
+              if mask[k] != i {
+                mask[k] = i;
+                length += 1;
+              }
+            }
+          }
+          indPtr[i+1] = length: idxType;
+        }
+      } else {
+        // Dense accumulator, with touched columns linked into a stack
+        var next: [1..N] idxType = -1,
+            sums: [1..N] eltType;
+
+        for i in rows {
+          var head = 0: idxType,
+              length = 0;
+
+          // Maps row index (i) -> nnz index of A
+          for jj in A.indPtr[i]..A.indPtr[i+1]-1 {
+            // Non-zero column index of A for row i
+            const j = A.indices[jj];
+            const v = A.data[jj];
+
+            // Maps row index (j) -> nnz index of B
+            for kk in B.indPtr[j]..B.indPtr[j+1]-1 {
+              // Non-zero column index of B for row j
+              const k = B.indices[kk];
+
+              sums[k] += v*B.data[kk];
+
+              // push k to stack
+              if next[k] == -1 {
+                next[k] = head;
+                head = k;
+                length += 1;
+              }
+            }
+          }
 
-    var nnz = 1;
+          var nnz = indPtr[i];
+          for 1..length {
+            indices[nnz] = head;
+            data[nnz] = sums[head];
+            nnz += 1;
+
+            // pop next k off stack, clearing it as we traverse
+            const temp = head;
+            head = next[head];
+            next[temp] = -1;
+            sums[temp] = 0;
+          }
+        }
+      }
+    } else {
+      // Hash accumulator; column indices start at 1, so 0 marks empty slots
+      var capacity = 1;
+      while capacity < 2 * maxRowWork do capacity *= 2;
+      const mask = capacity - 1;
+
+      var keys: [0..#capacity] idxType,
+          sums: [0..#(if numeric then capacity else 0)] eltType,
+          slots: [0..#maxRowWork] int;
+
+      for i in rows {
+        var length = 0;
+
+        for jj in A.indPtr[i]..A.indPtr[i+1]-1 {
+          const j = A.indices[jj];
+          for kk in B.indPtr[j]..B.indPtr[j+1]-1 {
+            const k = B.indices[kk];
+
+            var slot = ((k:uint * 0x9E3779B97F4A7C15) >> 32):int & mask;
+            while keys[slot] != 0 && keys[slot] != k do
+              slot = (slot + 1) & mask;
+            if keys[slot] == 0 {
+              keys[slot] = k;
+              slots[length] = slot;
+              length += 1;
+            }
+            if numeric then
+              sums[slot] += A.data[jj] * B.data[kk];
+          }
+        }
 
-    for i in 1..M {
-      var head = 0:idxType,
-          length = 0:idxType;
-
-      // Maps row index (i) -> nnz index of A
-      const Arange = A.indPtr[i]..A.indPtr[i+1]-1;
-      for jj in Arange {
-        // Non-zero column index of A for row i
-        const j = A.indices[jj];
-        const v = A.data[jj];
-
-        // Maps row index (j) -> nnz index of B
-        const Brange = B.indPtr[j]..B.indPtr[j+1]-1;
-        for kk in Brange {
-          // Non-zero column index of B for row j
-          const k = B.indices[kk];
-
-          sums[k] += v*B.data[kk];
-
-          // push k to stack
-          if next[k] == -1 {
-            next[k] = head;
-            head = k;
-            length += 1;
+        if numeric {
+          var nnz = indPtr[i];
+          for s in 0..#length by -1 {
+            const slot = slots[s];
+            indices[nnz] = keys[slot];
+            data[nnz] = sums[slot];
+            nnz += 1;
+            keys[slot] = 0;
+            sums[slot] = 0;
           }
+        } else {
+          indPtr[i+1] = length: idxType;
+          for s in 0..#length do
+            keys[slots[s]] = 0;
         }
       }
+    }
+  }
 
-      // Recounting is faster than accessing 'nnz in indPtr[i]..indPtr[i+1]-1'
-      for 1..length {
-        indices[nnz] = head;
-        data[nnz] = sums[head];
+  pragma "no doc"
+  /* Populate indPtr and total nnz (last element of indPtr) */
+  proc pass1(A: [?ADom] ?eltType, B: [?BDom] eltType, ref indPtr,
+             const ref bounds, maxRowWork) {
+    const (K2, N) = B.shape;
+    var noIndices: [1..0] ADom.idxType, noData: [1..0] eltType;
 
-        nnz += 1;
+    // Count the non-zeros of each row into indPtr[i+1]
+    coforall t in bounds.domain.low..bounds.domain.high-1 with (ref indPtr) do
+      _spgemmRows(A, B, bounds[t]..bounds[t+1]-1, N, maxRowWork,
+                  numeric=false, indPtr, noIndices, noData);
 
-        // pop next k off stack
-        const temp = head;
-        head = next[head];
+    indPtr[1] = 1;
+    _prefixSum(indPtr);
+  }
 
-        // clear stack as we traverse
-        next[temp] = -1;
-        sums[temp] = 0;
-      }
-    }
+  pragma "no doc"
+  /* Populate indices and data */
+  proc pass2(A: [?ADom] ?eltType, B: [?BDom] eltType, ref indPtr,
+             ref indices, ref data, const ref bounds, maxRowWork) {
+    const (K2, N) = B.shape;
+
+    coforall t in bounds.domain.low..bounds.domain.high-1
+      with (ref indices, ref data) do
+      _spgemmRows(A, B, bounds[t]..bounds[t+1]-1, N, maxRowWork,
+                  numeric=true, indPtr, indices, data);
   }
 
 
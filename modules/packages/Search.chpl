@@ -204,4 +204,80 @@ proc binarySearch(Data:[?Dom], val, comparator:?rec=defaultComparator, in lo=Dom
   where Dom.rank != 1 {
     compilerError("binarySearch() requires 1-D array");
 }
+
+
+/*
+   Searches through the pre-sorted array `Data` for each of the values in
+   `vals`, in parallel.  Each result is what :proc:`binarySearch` returns for
+   that value, except that when a value occurs more than once in `Data`,
+   the location of its first occurrence is returned.
+
+   Values are searched in groups that step through `Data` in lockstep with
+   a branch-free search, so the memory accesses of a group overlap instead
+   of each waiting on the previous one.
+
+   :arg Data: The sorted array to search
+   :type Data: [] `eltType`
+   :arg vals: The values to find in the array
+   :type vals: [] `eltType`
+   :arg comparator: :ref:`Comparator <comparators>` record that defines how the
+      data is sorted.
+
+   :returns: An array over the domain of `vals` of tuples indicating (1) if
+      the value was found and (2) the location of the value if it was found
+      or the location where the value should have been if it was not found.
+   :rtype: [] (`bool`, `Dom.idxType`)
+ */
+proc binarySearchMany(Data:[?Dom], vals:[?VDom], comparator:?rec=defaultComparator) {
+  chpl_check_comparator(comparator, Data.eltType);
+
+  param groupSize = 8;
+  const n = Dom.size,
+        numGroups = VDom.size / groupSize;
+  var Result: [VDom] (bool, Dom.idxType);
+
+  inline proc elt(p: int) const ref return Data[_posToIndex(Dom, p)];
+
+  // Search for the values at positions first..#size of vals
+  proc searchGroup(param size: int, first: int) {
+    var pos: size*int;
+    var val: size*vals.eltType;
+    for param l in 1..size do
+      val[l] = vals[_posToIndex(VDom, first + l - 1)];
+
+    // Narrow each search to one position, all with the same step sizes
+    var len = n;
+    while len > 1 {
+      const half = len / 2;
+      for param l in 1..size do
+        pos[l] += if chpl_compare(elt(pos[l] + half), val[l],
+                                  comparator) < 0 then half else 0;
+      len -= half;
+    }
+
+    for param l in 1..size {
+      if len == 1 && chpl_compare(elt(pos[l]), val[l], comparator) < 0 then
+        pos[l] += 1;
+      const found = pos[l] < n &&
+                    chpl_compare(elt(pos[l]), val[l], comparator) == 0;
+      Result[_posToIndex(VDom, first + l - 1)] =
+        (found, _posToIndex(Dom, pos[l]));
+    }
+  }
+
+  forall g in 0..#numGroups do
+    searchGroup(groupSize, g * groupSize);
+  forall p in numGroups*groupSize..VDom.size-1 do
+    searchGroup(1, p);
+
+  return Result;
+}
+
+
+pragma "no doc"
+/* Error message for multi-dimension arrays */
+proc binarySearchMany(Data:[?Dom], vals, comparator:?rec=defaultComparator)
+  where Dom.rank != 1 {
+    compilerError("binarySearchMany() requires 1-D array");
+}
 } // Search module
@@ -505,6 +505,434 @@ proc isSorted(Data: [?Dom] ?eltType, comparator:?rec=defaultComparator)
 }
 
 
+/* Parallel Primitives */
+
+//
+// The primitives below index `Data` by position: position `p` is the
+// element at ``Dom.alignedLow + p*abs(Dom.stride)``, matching the order
+// that isSorted() and binarySearch() use.
+//
+pragma "no doc"
+inline proc _posToIndex(Dom, p: int) {
+  const stride = if Dom.stridable then abs(Dom.stride) else 1;
+  return Dom.alignedLow + (p * stride): Dom.idxType;
+}
+
+pragma "no doc"
+proc _primitiveTasks(n: int) {
+  const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                   else dataParTasksPerLocale;
+  return max(1, min(numTasks, n));
+}
+
+
+/*
+   Merge the sorted runs in array `Data` into a new sorted array, in
+   parallel.  Each run starts at one of the indices in `runStarts` and ends
+   just before the next one starts; the last run ends at the end of `Data`.
+
+   The merge is stable: equal elements keep their order within a run, and
+   equal elements from an earlier run come before those from a later one.
+
+   The output is divided evenly between tasks.  For each dividing point,
+   the number of elements each run contributes before it is found by a
+   k-way selection over the runs (merge-path partitioning generalized to
+   many runs), so each task then merges its part independently.
+
+   :arg Data: The array of sorted runs
+   :type Data: [] `eltType`
+   :arg runStarts: Increasing indices of the first element of each run,
+      starting with ``Dom.low``
+   :type runStarts: [] `Dom.idxType`
+   :arg comparator: :ref:`Comparator <comparators>` record that defines how the
+      data is sorted.
+   :returns: An array over the domain of `Data` holding the merged elements
+ */
+proc mergeRuns(Data: [?Dom] ?eltType, runStarts: [] Dom.idxType,
+               comparator:?rec=defaultComparator) {
+  chpl_check_comparator(comparator, eltType);
+
+  const n = Dom.size,
+        k = runStarts.size,
+        stride = if Dom.stridable then abs(Dom.stride) else 1;
+  var Result: [Dom] eltType;
+
+  if n == 0 then
+    return Result;
+  if k == 0 then
+    halt("mergeRuns() requires at least one run");
+
+  // bounds[j]..bounds[j+1]-1 are the positions of run j
+  var bounds: [0..k] int;
+  for (b, s) in zip(bounds[0..#k], runStarts) do
+    b = ((s - Dom.alignedLow) / stride): int;
+  bounds[k] = n;
+
+  if boundsChecking {
+    if bounds[0] != 0 then
+      halt("mergeRuns() requires the first run to start at ", Dom.low);
+    for j in 0..#k do
+      if bounds[j] > bounds[j+1] then
+        halt("mergeRuns() requires runStarts to be increasing indices of Data");
+  }
+
+  inline proc elt(p: int) const ref return Data[_posToIndex(Dom, p)];
+
+  // First position in run j holding an element after v (or not before v)
+  proc bound(j: int, v, param upper: bool) {
+    var lo = bounds[j], hi = bounds[j+1];
+    while lo < hi {
+      const mid = lo + (hi - lo) / 2;
+      const cmp = chpl_compare(elt(mid), v, comparator);
+      if cmp < 0 || (upper && cmp == 0) then lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  }
+
+  const numTasks = _primitiveTasks(n);
+
+  // splits[t, j] is the position in run j where task t starts merging
+  var splits: [0..numTasks, 0..#k] int;
+  splits[0, ..] = bounds[0..#k];
+  splits[numTasks, ..] = bounds[1..k];
+
+  forall t in 1..numTasks-1 {
+    const s = t * n / numTasks;
+
+    // Narrow a window lo[j]..hi[j]-1 of each run to the elements that may
+    // still fall on either side of output rank s: everything before lo[j]
+    // comes before it and nothing from hi[j] on does.  Each round ranks the
+    // weighted median of the window midpoints, which removes at least a
+    // quarter of the remaining window elements, so a split costs O(log n)
+    // rounds of k binary searches.
+    var lo, hi, cnt, cand: [0..#k] int;
+    lo = bounds[0..#k];
+    hi = bounds[1..k];
+
+    inline proc midOf(j: int) return lo[j] + (hi[j] - lo[j]) / 2;
+
+    inline proc midBefore(a: int, b: int) {
+      const cmp = chpl_compare(elt(midOf(a)), elt(midOf(b)), comparator);
+      return cmp < 0 || (cmp == 0 && a < b);
+    }
+
+    // Heapsort cand[0..#m] by midpoint
+    proc sortCand(m: int) {
+      proc siftDown(in i: int, size: int) {
+        while true {
+          var c = i;
+          const l = 2*i + 1, r = l + 1;
+          if l < size && midBefore(cand[c], cand[l]) then c = l;
+          if r < size && midBefore(cand[c], cand[r]) then c = r;
+          if c == i then return;
+          cand[i] <=> cand[c];
+          i = c;
+        }
+      }
+
+      for i in 0..#(m/2) by -1 do
+        siftDown(i, m);
+      for last in 1..m-1 by -1 {
+        cand[0] <=> cand[last];
+        siftDown(0, last);
+      }
+    }
+
+    while true {
+      var m = 0, total = 0;
+      for j in 0..#k do
+        if lo[j] < hi[j] {
+          cand[m] = j;
+          m += 1;
+          total += hi[j] - lo[j];
+        }
+      if m == 0 then break;
+
+      sortCand(m);
+      var p = 0, weight = hi[cand[0]] - lo[cand[0]];
+      while 2*weight < total {
+        p += 1;
+        weight += hi[cand[p]] - lo[cand[p]];
+      }
+
+      // cnt[jj] is the number of elements of run jj before the pivot
+      const j = cand[p], i = midOf(j), v = elt(i);
+      var r = 0;
+      for jj in 0..#k {
+        cnt[jj] = if jj < j then bound(jj, v, upper=true)
+                  else if jj > j then bound(jj, v, upper=false)
+                  else i;
+        r += cnt[jj] - bounds[jj];
+      }
+
+      if r == s {
+        lo = cnt;
+        break;
+      } else if r < s {
+        for jj in 0..#k do lo[jj] = max(lo[jj], cnt[jj]);
+        lo[j] = i + 1;
+      } else {
+        for jj in 0..#k do hi[jj] = min(hi[jj], cnt[jj]);
+      }
+    }
+
+    splits[t, ..] = lo;
+  }
+
+  coforall t in 0..#numTasks {
+    var cur, stop: [0..#k] int;
+    cur = splits[t, ..];
+    stop = splits[t+1, ..];
+
+    // A binary heap of the runs that still have elements in this part,
+    // ordered by their next element, then by run
+    var heap: [0..#k] int, size = 0;
+
+    inline proc before(a: int, b: int) {
+      const cmp = chpl_compare(elt(cur[a]), elt(cur[b]), comparator);
+      return cmp < 0 || (cmp == 0 && a < b);
+    }
+
+    proc siftDown(in i: int) {
+      while true {
+        var m = i;
+        const l = 2*i + 1, r = l + 1;
+        if l < size && before(heap[l], heap[m]) then m = l;
+        if r < size && before(heap[r], heap[m]) then m = r;
+        if m == i then return;
+        heap[i] <=> heap[m];
+        i = m;
+      }
+    }
+
+    for j in 0..#k do
+      if cur[j] < stop[j] {
+        heap[size] = j;
+        size += 1;
+      }
+    for i in 0..#(size/2) by -1 do
+      siftDown(i);
+
+    var next = t * n / numTasks;
+    while size > 0 {
+      const j = heap[0];
+      Result[_posToIndex(Dom, next)] = elt(cur[j]);
+      next += 1;
+      cur[j] += 1;
+      if cur[j] == stop[j] {
+        size -= 1;
+        heap[0] = heap[size];
+      }
+      siftDown(0);
+    }
+  }
+
+  return Result;
+}
+
+
+pragma "no doc"
+/* Error message for multi-dimension arrays */
+proc mergeRuns(Data: [?Dom] ?eltType, runStarts,
+               comparator:?rec=defaultComparator)
+  where Dom.rank != 1 {
+    compilerError("mergeRuns() requires 1-D array");
+}
+
+
+/*
+   Reorder array `Data` in parallel so that the elements for which `pred`
+   returns ``true`` come before those for which it returns ``false``.  The
+   partition is stable: each group keeps its original relative order.
+   `pred` is called exactly once per element.
+
+   :arg Data: The array to partition
+   :type Data: [] `eltType`
+   :arg pred: A function or first-class function taking an element and
+      returning a `bool`
+   :returns: The number of elements for which `pred` returned ``true``
+   :rtype: `int`
+ */
+proc stablePartition(Data: [?Dom] ?eltType, pred): int {
+  use RangeChunk;
+
+  const n = Dom.size;
+  if n == 0 then
+    return 0;
+
+  const numTasks = _primitiveTasks(n);
+  var flags: [0..#n] bool;
+  var numTrue: [0..#numTasks] int;
+
+  coforall t in 0..#numTasks {
+    var count = 0;
+    for p in chunk(0..#n, numTasks, t) {
+      const f = pred(Data[_posToIndex(Dom, p)]): bool;
+      flags[p] = f;
+      if f then count += 1;
+    }
+    numTrue[t] = count;
+  }
+
+  var trueBefore: [0..#numTasks] int, totalTrue = 0;
+  for t in 0..#numTasks {
+    trueBefore[t] = totalTrue;
+    totalTrue += numTrue[t];
+  }
+
+  var Tmp: [0..#n] eltType;
+  coforall t in 0..#numTasks {
+    const part = chunk(0..#n, numTasks, t);
+    var nextTrue = trueBefore[t],
+        nextFalse = totalTrue + part.low - trueBefore[t];
+    for p in part {
+      if flags[p] {
+        Tmp[nextTrue] = Data[_posToIndex(Dom, p)];
+        nextTrue += 1;
+      } else {
+        Tmp[nextFalse] = Data[_posToIndex(Dom, p)];
+        nextFalse += 1;
+      }
+    }
+  }
+
+  forall p in 0..#n do
+    Data[_posToIndex(Dom, p)] = Tmp[p];
+
+  return totalTrue;
+}
+
+
+pragma "no doc"
+/* Error message for multi-dimension arrays */
+proc stablePartition(Data: [?Dom] ?eltType, pred): int
+  where Dom.rank != 1 {
+    compilerError("stablePartition() requires 1-D array");
+}
+
+
+//
+// Returns the positions where each run of equal elements in Data starts,
+// followed by Data.size, computed in two parallel passes: one counting the
+// runs that start in each task's part, and one writing their positions.
+//
+pragma "no doc"
+proc _runStarts(Data: [?Dom] ?eltType, comparator) {
+  use RangeChunk;
+
+  const n = Dom.size;
+  if n == 0 {
+    var starts: [0..0] int;
+    return starts;
+  }
+
+  const numTasks = _primitiveTasks(n);
+
+  inline proc startsRun(p: int) {
+    return p == 0 || chpl_compare(Data[_posToIndex(Dom, p-1)],
+                                  Data[_posToIndex(Dom, p)], comparator) != 0;
+  }
+
+  var numRuns: [0..#numTasks] int;
+  coforall t in 0..#numTasks {
+    var count = 0;
+    for p in chunk(0..#n, numTasks, t) do
+      if startsRun(p) then count += 1;
+    numRuns[t] = count;
+  }
+
+  var runsBefore: [0..#numTasks] int, total = 0;
+  for t in 0..#numTasks {
+    runsBefore[t] = total;
+    total += numRuns[t];
+  }
+
+  var starts: [0..total] int;
+  starts[total] = n;
+  coforall t in 0..#numTasks {
+    var next = runsBefore[t];
+    for p in chunk(0..#n, numTasks, t) do
+      if startsRun(p) {
+        starts[next] = p;
+        next += 1;
+      }
+  }
+
+  return starts;
+}
+
+
+/*
+   Return the distinct elements of the sorted array `Data`, in order,
+   computed in parallel.  The first of each run of equal elements is kept.
+
+   :arg Data: The sorted array
+   :type Data: [] `eltType`
+   :arg comparator: :ref:`Comparator <comparators>` record that defines how the
+      data is sorted.
+   :returns: An array over ``{Dom.low..#m}`` of the `m` distinct elements
+ */
+proc unique(Data: [?Dom] ?eltType, comparator:?rec=defaultComparator) {
+  chpl_check_comparator(comparator, eltType);
+
+  const starts = _runStarts(Data, comparator);
+  const m = starts.size - 1;
+
+  var Result: [Dom.low..#m] eltType;
+  forall (r, i) in zip(Result, 0..#m) do
+    r = Data[_posToIndex(Dom, starts[i])];
+
+  return Result;
+}
+
+
+pragma "no doc"
+/* Error message for multi-dimension arrays */
+proc unique(Data: [?Dom] ?eltType, comparator:?rec=defaultComparator)
+  where Dom.rank != 1 {
+    compilerError("unique() requires 1-D array");
+}
+
+
+/*
+   Run-length encode the sorted array `Data` in parallel, returning each
+   distinct element along with the number of times it occurs.
+
+   :arg Data: The sorted array
+   :type Data: [] `eltType`
+   :arg comparator: :ref:`Comparator <comparators>` record that defines how the
+      data is sorted.
+   :returns: A tuple of arrays over ``{Dom.low..#m}``, holding the `m`
+      distinct elements and their counts
+ */
+proc runLengthEncode(Data: [?Dom] ?eltType,
+                     comparator:?rec=defaultComparator) {
+  chpl_check_comparator(comparator, eltType);
+
+  const starts = _runStarts(Data, comparator);
+  const m = starts.size - 1;
+
+  var Values: [Dom.low..#m] eltType;
+  var Counts: [Dom.low..#m] int;
+  forall (v, c, i) in zip(Values, Counts, 0..#m) {
+    v = Data[_posToIndex(Dom, starts[i])];
+    c = starts[i+1] - starts[i];
+  }
+
+  return (Values, Counts);
+}
+
+
+pragma "no doc"
+/* Error message for multi-dimension arrays */
+proc runLengthEncode(Data: [?Dom] ?eltType,
+                     comparator:?rec=defaultComparator)
+  where Dom.rank != 1 {
+    compilerError("runLengthEncode() requires 1-D array");
+}
+
+
 //
 // This is a first draft "sorterator" which is designed to take some
 // other iterator/iterable and yield its elements, in sorted order.
@@ -848,12 +848,13 @@ module ZMQ {
         // TODO: If *not crossing locales*, check for ownership and
         // conditionally have ZeroMQ free the memory.
         var copy = new string(s=data, isowned=true);
-        copy.isowned = false;
+        const len = copy.length;
+        const buff = copy._releaseBuffer();
 
         // Create the ZeroMQ message from the string buffer
         var msg: zmq_msg_t;
-        if (0 != zmq_msg_init_data(msg, copy.c_str():c_void_ptr,
-                                   copy.length:size_t, c_ptrTo(free_helper),
+        if (0 != zmq_msg_init_data(msg, buff:c_void_ptr,
+                                   len:size_t, c_ptrTo(free_helper),
                                    c_nil)) {
           try throw_socket_error(errno, "send");
         }
@@ -226,7 +226,8 @@ module BigInteger {
 
     proc init(str: string, base: int = 0) {
       this.complete();
-      const str_  = str.localize().c_str();
+      const localStr = str.localize();
+      const str_  = localStr.c_str();
       const base_ = base.safeCast(c_int);
 
       if mpz_init_set_str(this.mpz, str_, base_) != 0 {
@@ -240,7 +241,8 @@ module BigInteger {
 
     proc init(str: string, base: int = 0, out error: syserr) {
       this.complete();
-      const str_  = str.localize().c_str();
+      const localStr = str.localize();
+      const str_  = localStr.c_str();
       const base_ = base.safeCast(c_int);
 
       if mpz_init_set_str(this.mpz, str_, base_) != 0 {
@@ -890,20 +892,139 @@ module BigInteger {
 
 
   // Multiplication
+
+  /*
+     Multiplications of two ``bigint`` values that both have at least this
+     many limbs, using ``*``, ``*=`` or :proc:`bigint.mul`, are split into
+     smaller products that are computed by several tasks.  A value of 0
+     disables the parallel multiplication.
+   */
+  config const bigintParMulLimbs = 4096;
+
+  // Compute rop = op1 * op2 for mpz values on this locale.  rop may be the
+  // same as op1 or op2.
+  private inline proc mulLocal(ref rop: mpz_t,
+                               const ref op1: mpz_t,
+                               const ref op2: mpz_t) {
+    const minLimbs = min(mpz_size(op1), mpz_size(op2)):int;
+    const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                     else dataParTasksPerLocale;
+
+    if bigintParMulLimbs > 0 && minLimbs >= bigintParMulLimbs &&
+       numTasks > 1 {
+      // Each level of splitting creates three products.
+      var depth = 0;
+      var numProducts = 1;
+
+      while numProducts < numTasks &&
+            (minLimbs >> (depth + 1)) >= bigintParMulLimbs / 2 {
+        depth       += 1;
+        numProducts *= 3;
+      }
+
+      parMul(rop, op1, op2, depth);
+
+    } else {
+      mpz_mul(rop, op1, op2);
+    }
+  }
+
+  // Split a large multiplication into three smaller ones following
+  // Karatsuba and compute them in parallel, recursing depth times.  GMP
+  // uses its own Toom and FFT algorithms for the products at the leaves.
+  //
+  // With op1 = a1 * 2^h + a0 and op2 = b1 * 2^h + b0, where the parts keep
+  // the sign of the value they come from,
+  //
+  //   op1 * op2 = z2 * 2^2h + (z1 - z2 - z0) * 2^h + z0
+  //
+  // where z0 = a0 * b0, z2 = a1 * b1 and z1 = (a0 + a1) * (b0 + b1).
+  private proc parMul(ref rop: mpz_t,
+                      const ref op1: mpz_t,
+                      const ref op2: mpz_t,
+                      depth: int) {
+    if depth == 0 {
+      mpz_mul(rop, op1, op2);
+      return;
+    }
+
+    const limbBits = mp_bits_per_limb:int;
+    const maxLimbs = max(mpz_size(op1), mpz_size(op2)):int;
+    const hLimbs   = (maxLimbs + 1) / 2;
+    const h        = (hLimbs * limbBits):mp_bitcnt_t;
+
+    // The temporaries are allocated at their final size up front, so GMP
+    // does not need to grow them as the products are computed.
+    const partBits    = h + limbBits:mp_bitcnt_t;
+    const productBits = 2 * partBits;
+
+    var a0, a1, b0, b1, z0, z1, z2: mpz_t;
+
+    mpz_init2(a0, partBits);
+    mpz_init2(a1, partBits);
+    mpz_init2(b0, partBits);
+    mpz_init2(b1, partBits);
+    mpz_init2(z0, productBits);
+    mpz_init2(z1, productBits);
+    mpz_init2(z2, productBits);
+
+    mpz_tdiv_r_2exp(a0, op1, h);
+    mpz_tdiv_q_2exp(a1, op1, h);
+    mpz_tdiv_r_2exp(b0, op2, h);
+    mpz_tdiv_q_2exp(b1, op2, h);
+
+    cobegin with (ref z0, ref z1, ref z2) {
+      parMul(z0, a0, b0, depth - 1);
+      parMul(z2, a1, b1, depth - 1);
+      {
+        var sa, sb: mpz_t;
+
+        mpz_init2(sa, partBits);
+        mpz_init2(sb, partBits);
+
+        mpz_add(sa, a0, a1);
+        mpz_add(sb, b0, b1);
+
+        parMul(z1, sa, sb, depth - 1);
+
+        mpz_clear(sa);
+        mpz_clear(sb);
+      }
+    }
+
+    // z1 = z1 - z2 - z0 is the middle term
+    mpz_sub(z1, z1, z2);
+    mpz_sub(z1, z1, z0);
+
+    // The operands are no longer read, so rop may be one of them.
+    mpz_mul_2exp(rop, z2, h);
+    mpz_add(rop, rop, z1);
+    mpz_mul_2exp(rop, rop, h);
+    mpz_add(rop, rop, z0);
+
+    mpz_clear(a0);
+    mpz_clear(a1);
+    mpz_clear(b0);
+    mpz_clear(b1);
+    mpz_clear(z0);
+    mpz_clear(z1);
+    mpz_clear(z2);
+  }
+
   proc *(const ref a: bigint, const ref b: bigint) {
     var c = new bigint();
 
     if _local {
-      mpz_mul(c.mpz, a.mpz, b.mpz);
+      mulLocal(c.mpz, a.mpz, b.mpz);
 
     } else if a.localeId == chpl_nodeID && b.localeId == chpl_nodeID {
-      mpz_mul(c.mpz, a.mpz, b.mpz);
+      mulLocal(c.mpz, a.mpz, b.mpz);
 
     } else {
       const a_ = a;
       const b_ = b;
 
-      mpz_mul(c.mpz, a_.mpz, b_.mpz);
+      mulLocal(c.mpz, a_.mpz, b_.mpz);
     }
 
     return c;
@@ -1735,10 +1856,10 @@ module BigInteger {
   // *=
   proc *=(ref a: bigint, const ref b: bigint) {
     if _local {
-      mpz_mul(a.mpz, a.mpz, b.mpz);
+      mulLocal(a.mpz, a.mpz, b.mpz);
 
     } else if a.localeId == chpl_nodeID && b.localeId == chpl_nodeID {
-      mpz_mul(a.mpz, a.mpz, b.mpz);
+      mulLocal(a.mpz, a.mpz, b.mpz);
 
     } else {
       const aLoc = chpl_buildLocaleID(a.localeId, c_sublocid_any);
@@ -1746,7 +1867,7 @@ module BigInteger {
       on __primitive("chpl_on_locale_num", aLoc) {
         const b_ = b;
 
-        mpz_mul(a.mpz, a.mpz, b_.mpz);
+        mulLocal(a.mpz, a.mpz, b_.mpz);
       }
     }
   }
@@ -3728,12 +3849,12 @@ When ``n/d`` does not produce an integer, this method may produce incorrect resu
 
   proc bigint.mul(const ref a: bigint, const ref b: bigint) {
     if _local {
-      mpz_mul(this.mpz, a.mpz, b.mpz);
+      mulLocal(this.mpz, a.mpz, b.mpz);
 
     } else if this.localeId == chpl_nodeID &&
               a.localeId    == chpl_nodeID &&
               b.localeId    == chpl_nodeID {
-      mpz_mul(this.mpz, a.mpz, b.mpz);
+      mulLocal(this.mpz, a.mpz, b.mpz);
 
     } else {
       const thisLoc = chpl_buildLocaleID(this.localeId, c_sublocid_any);
@@ -3742,7 +3863,7 @@ When ``n/d`` does not produce an integer, this method may produce incorrect resu
         const a_ = a;
         const b_ = b;
 
-        mpz_mul(this.mpz, a_.mpz, b_.mpz);
+        mulLocal(this.mpz, a_.mpz, b_.mpz);
       }
     }
   }
@@ -890,6 +890,11 @@ private extern proc qio_file_sync(f:qio_file_ptr_t):syserr;
 private extern proc qio_channel_end_offset_unlocked(ch:qio_channel_ptr_t):int(64);
 private extern proc qio_file_get_style(f:qio_file_ptr_t, ref style:iostyle);
 private extern proc qio_file_length(f:qio_file_ptr_t, ref len:int(64)):syserr;
+private extern proc qio_file_mmap_region(f:qio_file_ptr_t, offset:int(64), len:int(64), hints:c_int, ref data:c_void_ptr, ref free_func:c_void_ptr):syserr;
+private extern proc qio_file_open_staging(ref file_out:qio_file_ptr_t, const ref style:iostyle):syserr;
+private extern proc qio_file_staged_length(f:qio_file_ptr_t):int(64);
+private extern proc qio_file_staged_flushed(f:qio_file_ptr_t):int(64);
+private extern proc qio_file_staged_pwrite(staging:qio_file_ptr_t, dst:qio_file_ptr_t, offset:int(64)):syserr;
 
 pragma "no prototype" // FIXME
 private extern proc qio_channel_create(ref ch:qio_channel_ptr_t, file:qio_file_ptr_t, hints:c_int, readable:c_int, writeable:c_int, start:int(64), end:int(64), const ref style:iostyle):syserr;
@@ -934,6 +939,8 @@ private extern proc qio_channel_write_amt(threadsafe:c_int, ch:qio_channel_ptr_t
 pragma "no doc"
 // A specialization is needed for _ddata as the value is the pointer its memory
 private extern proc qio_channel_write_amt(threadsafe:c_int, ch:qio_channel_ptr_t, const ptr:_ddata, len:ssize_t):syserr;
+// and for c_ptr
+private extern proc qio_channel_write_amt(threadsafe:c_int, ch:qio_channel_ptr_t, const ptr:c_ptr, len:ssize_t):syserr;
 private extern proc qio_channel_write_byte(threadsafe:c_int, ch:qio_channel_ptr_t, byte:uint(8)):syserr;
 
 private extern proc qio_channel_offset_unlocked(ch:qio_channel_ptr_t):int(64);
@@ -1526,6 +1533,65 @@ proc file.length():int(64) throws {
   return len;
 }
 
+/*
+
+Create a 1D array of ``eltType`` whose elements are the binary contents of
+a region of this file, without reading the file. The file is mapped into
+memory and pages of it are only read when the corresponding elements are
+first accessed, so even very large files can be opened quickly.
+
+The elements are stored in the native byte order, and the array's indices
+are ``0..#numElements``. The array can be modified, but the changes are
+never written to the file: the mapping is copy-on-write, so the first write
+to a page of the array gives the array its own copy of that page. The file
+should not be truncated while the array exists.
+
+This function must be called on the locale where the file was opened.
+
+:arg eltType: the type of the array elements, which must be a numeric type
+:arg start: the file offset of the first element. This must be a multiple
+            of the size of ``eltType``.
+:arg numElements: the number of elements in the array. By default,
+                  the array covers the file from ``start`` to its end.
+:arg hints: optional argument to describe how the array will be accessed,
+            used to advise the operating system. See :type:`iohints`.
+:returns: an array backed by the file's data
+
+:throws SystemError: Thrown if the region could not be mapped.
+*/
+proc file.mmapArray(type eltType, start:int(64) = 0, numElements:int = -1,
+                    hints:iohints = IOHINT_NONE) throws
+                    where isNumericType(eltType) {
+  use ExternalArray;
+
+  var err:syserr = ENOERR;
+  var n = numElements;
+  var data:c_void_ptr;
+  var freeFunc:c_void_ptr;
+
+  if here != this.home then
+    try ioerror(EINVAL:syserr, "in file.mmapArray(): not on the file's locale");
+  if start < 0 || start % numBytes(eltType) != 0 then
+    try ioerror(EINVAL:syserr, "in file.mmapArray(): unaligned start");
+
+  if n < 0 then
+    n = ((try this.length()) - start) / numBytes(eltType);
+
+  if n > 0 {
+    err = qio_file_mmap_region(this._file_internal, start,
+                               n * numBytes(eltType), hints,
+                               data, freeFunc);
+    if err then try ioerror(err, "in file.mmapArray()");
+  }
+
+  var ext = chpl_make_external_array_ptr(data, max(n, 0):uint);
+  ext.freer = freeFunc;
+  var ret = makeArrayFromExternArray(ext, eltType);
+  // The array owns the mapping and unmaps it when it is destroyed.
+  ret._value._borrowed = false;
+  return ret;
+}
+
 // these strings are here (vs in _modestring)
 // in an attempt to avoid string copies, leaks,
 // and unnecessary allocations.
@@ -2692,6 +2758,10 @@ proc file.reader(out error:syserr, param kind=iokind.dynamic, param locking=true
 
 /* Iterate over all of the lines in a file.
 
+   The returned object also supports parallel iteration, for example with
+   ``forall line in f.lines()``, in which case the lines are read by
+   several tasks at once and are not yielded in order.
+
    :returns: an object which yields strings read from the file
 
    :throws SystemError: Thrown if an ItemReader could not be returned.
@@ -2708,7 +2778,7 @@ proc file.lines(param locking:bool = true, start:int(64) = 0, end:int(64) = max(
   var err:syserr = ENOERR;
   on this.home {
     var ch = new channel(false, kind, locking, this, err, hints, start, end, local_style);
-    ret = new ItemReader(string, kind, locking, ch);
+    ret = new ItemReader(string, kind, locking, ch, this, start, end, hints);
   }
   if err then try ioerror(err, "in file.lines", this.tryGetPath());
 
@@ -2814,6 +2884,183 @@ proc file.writer(out error:syserr, param kind=iokind.dynamic, param locking=true
   return ret;
 }
 
+/*
+   Write the elements of a rectangular array to this file in binary, in
+   native byte order, starting at the file offset ``start``. The file will
+   contain the same bytes as it would after
+
+   .. code-block:: chapel
+
+     file.writer(kind=ionative, start=start).write(A);
+
+   but for arrays of numeric types with a single local subdomain per
+   locale (e.g. default or Block-distributed arrays), each locale writes
+   its own part of the array in parallel, using several tasks that each
+   write to a separate region of the file.
+
+   Locales other than the one where this file was opened open it again by
+   its path, which must therefore refer to the same file on every locale.
+
+   :arg A: the array to write
+   :arg start: the file offset where the first element is written
+
+   :throws SystemError: Thrown if the array could not be written.
+ */
+proc file.writeBinaryArray(A: [], start:int(64) = 0) throws
+    where isRectangularArr(A) {
+  if _canParallelBinaryArrayIO(A) {
+    try _parallelBinaryArrayIO(this, A, start, writing=true);
+  } else {
+    var w = try this.writer(kind=iokind.native, start=start);
+    try w.write(A);
+    try w.close();
+  }
+}
+
+/*
+   Read the elements of a rectangular array from this file in binary, in
+   native byte order, starting at the file offset ``start``. This reads
+   data in the format written by :proc:`file.writeBinaryArray` and, like
+   it, reads the parts of the array stored on each locale in parallel
+   when possible.
+
+   :arg A: the array to read into
+   :arg start: the file offset of the first element
+
+   :throws SystemError: Thrown if the array could not be read.
+ */
+proc file.readBinaryArray(ref A: [], start:int(64) = 0) throws
+    where isRectangularArr(A) {
+  if _canParallelBinaryArrayIO(A) {
+    try _parallelBinaryArrayIO(this, A, start, writing=false);
+  } else {
+    var r = try this.reader(kind=iokind.native, start=start);
+    try r.read(A);
+    try r.close();
+  }
+}
+
+// Parts of a contiguous run of array elements smaller than this are not
+// split further between tasks.
+private const binaryArrayMinPieceBytes = 1 << 20;
+
+private proc _canParallelBinaryArrayIO(A) param {
+  return isNumericType(A.eltType) && !A.domain.stridable &&
+         !chpl__isArrayView(A._value) && A.hasSingleLocalSubdomain();
+}
+
+//
+// Each locale divides its local subdomain into runs of indices that are
+// consecutive in row-major order, and therefore in the file, and splits
+// those runs between tasks.  Each task reads or writes its piece with its
+// own channel covering just that region of the file, so the data for a
+// piece stored contiguously in memory is transferred with a single
+// pread/pwrite.
+//
+private proc _parallelBinaryArrayIO(f:file, A, start:int(64),
+                                    param writing:bool) throws {
+  param rank = A.rank;
+  type eltType = A.eltType;
+  const eltSize = numBytes(eltType);
+  const home = f.home;
+  var path:string;
+
+  for loc in A.targetLocales() do
+    if loc != home then path = try f.path;
+
+  coforall loc in A.targetLocales() with (ref A) do on loc {
+    const D = A.localSubdomain();
+    const G = A.domain;
+
+    if D.size > 0 {
+      var fl = f;
+      if here != home then
+        fl = try open(path, if writing then iomode.rw else iomode.r);
+
+      // Elements per step in each dimension of the file.
+      var mult: rank*int;
+      mult(rank) = 1;
+      for param d in 1..rank-1 by -1 do
+        mult(d) = mult(d+1) * G.dim(d+1).size;
+
+      // The trailing dimensions of D after dimension k span G, so the
+      // elements in dimensions k..rank form a single run.
+      var k = rank;
+      while k > 1 && D.dim(k) == G.dim(k) do k -= 1;
+
+      var numRuns = 1;
+      for d in 1..k-1 do numRuns *= D.dim(d).size;
+      const runLen = D.dim(k).size * mult(k);
+      const numTasks = if dataParTasksPerLocale > 0
+                       then dataParTasksPerLocale else here.maxTaskPar;
+      const numPieces = max(1, min(divceil(numTasks, numRuns),
+                                   runLen * eltSize / binaryArrayMinPieceBytes));
+
+      // Returns the index of the element at 'pos' within run 'r'.
+      proc runIndex(r:int, pos:int) {
+        var idx: rank*A.idxType;
+        var rest = r;
+        for d in 1..k-1 by -1 {
+          idx(d) = (D.dim(d).low + rest % D.dim(d).size):A.idxType;
+          rest /= D.dim(d).size;
+        }
+        rest = pos;
+        for d in k+1..rank by -1 {
+          idx(d) = (G.dim(d).low + rest % G.dim(d).size):A.idxType;
+          rest /= G.dim(d).size;
+        }
+        idx(k) = (D.dim(k).low + rest):A.idxType;
+        return idx;
+      }
+
+      proc fileOffset(idx) {
+        var pos = 0;
+        for param d in 1..rank do
+          pos += (idx(d) - G.dim(d).low):int * mult(d);
+        return start + pos * eltSize;
+      }
+
+      forall i in 0..#(numRuns * numPieces) with (ref A) {
+        const r = i / numPieces,
+              p = i % numPieces;
+        const lo = runLen * p / numPieces,
+              hi = runLen * (p + 1) / numPieces;
+        const first = runIndex(r, lo);
+        const offset = fileOffset(first);
+        const nbytes = (hi - lo) * eltSize;
+        const ptr = c_pointer_return(A[first]);
+        const contiguous =
+          c_pointer_return(A[runIndex(r, hi-1)]) == ptr + (hi - lo - 1);
+
+        if writing {
+          var w = try fl.writer(kind=iokind.native, locking=false,
+                                start=offset, end=offset+nbytes);
+          if contiguous {
+            try w.writeBytes(ptr, nbytes:ssize_t);
+          } else {
+            for pos in lo..hi-1 do
+              try w.write(A[runIndex(r, pos)]);
+          }
+          try w.close();
+        } else {
+          var rd = try fl.reader(kind=iokind.native, locking=false,
+                                 start=offset, end=offset+nbytes);
+          if contiguous {
+            try rd.readBytes(ptr, nbytes:ssize_t);
+          } else {
+            for pos in lo..hi-1 {
+              var x: eltType;
+              try rd.read(x);
+              c_pointer_return(A[runIndex(r, pos)]).deref() = x;
+            }
+          }
+          try rd.close();
+        }
+      }
+    }
+  }
+}
+
 pragma "no doc"
 proc _isSimpleIoType(type t) param return
   isBoolType(t) || isNumericType(t) || isEnumType(t);
@@ -3761,6 +4008,64 @@ proc channel.readline(arg: [] uint(8), out numRead : int, start = arg.domain.low
 }
 
 
+/*
+  Read whitespace-separated numbers into a Chapel array of integral or
+  real values, using the channel's current style. Reads until ``amount``
+  values have been read or the end of the channel is reached.
+
+  This is faster than reading the elements one at a time since the
+  channel is only locked once.
+
+  Throws a SystemError if a value could not be read from the channel.
+
+  :arg arg: A 1D DefaultRectangular array which must have at least 1 element.
+  :arg numRead: The number of values read.
+  :arg start: Index to begin reading into.
+  :arg amount: The maximum number of values to read.
+  :returns: true if any values were read without error, false upon EOF.
+*/
+proc channel.readArray(arg: [] ?t, out numRead : int, start = arg.domain.low,
+                       amount = arg.domain.high - start + 1) : bool throws
+                       where arg.rank == 1 && isRectangularArr(arg) &&
+                             (isIntegralType(t) || isRealType(t)) {
+  if writing then compilerError("read on write-only channel");
+
+  if arg.size == 0 || !arg.domain.contains(start) ||
+     amount <= 0 || (start + amount - 1 > arg.domain.high) then return false;
+
+  var err:syserr = ENOERR;
+  on this.home {
+    try! this.lock();
+    var i = start;
+    const maxIdx = start + amount - 1;
+    while i <= maxIdx {
+      var x:t;
+      if isIntegralType(t) then
+        err = qio_channel_scan_int(false, _channel_internal, x,
+                                   numBytes(t), isIntType(t));
+      else
+        err = qio_channel_scan_float(false, _channel_internal, x,
+                                     numBytes(t));
+      if err then break;
+      arg[i] = x;
+      i += 1;
+    }
+    numRead = i - start;
+    if err == EEOF && i > start then err = ENOERR;
+    this.unlock();
+  }
+
+  if !err {
+    return true;
+  } else if err == EEOF {
+    return false;
+  } else {
+    try this._ch_ioerror(err, "in channel.readArray(arg : [] " +
+                              t:string + ")");
+  }
+  return false;
+}
+
 /*
   Read a line into a Chapel string. Reads until a ``\n`` is reached.
   The ``\n`` is included in the resulting string.
@@ -4412,6 +4717,12 @@ proc channel.modifyStyle(f:func(iostyle, iostyle))
 }
 */
 
+/*
+   The minimum number of bytes of a file that each task reads when
+   iterating over :proc:`file.lines` in parallel.
+ */
+config const linesMinChunkBytes:int(64) = 64 * 1024;
+
 /* Wrapper class on a channel to make it only read values
    of a single type. Also supports an iterator yielding
    the read values.
@@ -4425,6 +4736,19 @@ record ItemReader {
   param locking:bool;
   /* our channel */
   var ch:channel(false,kind,locking);
+
+  // For readers created by file.lines(), the region of the file being
+  // read.  This allows the parallel iterators to divide the region
+  // between tasks, each reading with its own channel.
+  pragma "no doc"
+  var _file:file;
+  pragma "no doc"
+  var _start:int(64);
+  pragma "no doc"
+  var _end:int(64);
+  pragma "no doc"
+  var _hints:iohints;
+
   /* read a single item, throwing on error */
   proc read(out arg:ItemType):bool throws {
     return ch.read(arg);
@@ -4448,6 +4772,197 @@ record ItemReader {
       yield x;
     }
   }
+
+  /* Iterate in parallel through all items read from the file.
+
+     This is only supported for an :record:`ItemReader` returned by
+     :proc:`file.lines`; other readers are iterated serially.  The region
+     of the file is divided into one chunk per task and each chunk
+     boundary is moved forward to just after the next line separator, so
+     that every line is read by exactly one task.  Each task reads its
+     chunk with its own channel, and the order in which lines are yielded
+     is unspecified.  Since the lines are not numbered ahead of time, an
+     :record:`ItemReader` cannot be zippered with other iterands in a
+     ``forall`` loop.
+
+     When running on multiple locales, the region is first divided
+     between the locales, preferring the locales that
+     :proc:`file.localesForRegion` reports as local to each part.  Each
+     locale opens the file by its path, so this requires that the file be
+     accessible from every locale.
+   */
+  iter these(param tag:iterKind) where tag == iterKind.standalone {
+    if !_isFileRegion() {
+      for x in these() do yield x;
+    } else {
+      const (start, end) = _fileRegion();
+      const style = ch._style();
+      const path = _pathForLocales();
+
+      if numLocales == 1 || path == "" {
+        const bounds = _alignedChunks(_file, start, end, _numTasks(end-start),
+                                      style);
+        coforall chunk in 1..bounds.size-1 {
+          for x in _itemsInRegion(_file, bounds[chunk-1], bounds[chunk],
+                                  style) do
+            yield x;
+        }
+      } else {
+        const bounds = _alignedChunks(_file, start, end, numLocales, style);
+        coforall chunk in 1..bounds.size-1 {
+          const (locStart, locEnd) = (bounds[chunk-1], bounds[chunk]);
+          on _targetLocale(locStart, locEnd, Locales[chunk-1]) {
+            var f:file;
+            try {
+              f = open(path, iomode.r, _hints, style, url="");
+            } catch e {
+              halt("in ItemReader.these(): could not open ", path, " on ",
+                   here, ": ", e.message());
+            }
+            const locBounds = _alignedChunks(f, locStart, locEnd,
+                                             _numTasks(locEnd-locStart),
+                                             style);
+            coforall locChunk in 1..locBounds.size-1 {
+              for x in _itemsInRegion(f, locBounds[locChunk-1],
+                                      locBounds[locChunk], style) do
+                yield x;
+            }
+            try {
+              f.close();
+            } catch e {
+              halt("in ItemReader.these(): could not close ", path, " on ",
+                   here, ": ", e.message());
+            }
+          }
+        }
+      }
+    }
+  }
+
+  pragma "no doc"
+  proc _isFileRegion() {
+    if is_c_nil(_file._file_internal) then return false;
+    // Files whose length is not known, such as compressed streams, can
+    // only be read in order.
+    try {
+      _file.length();
+    } catch {
+      return false;
+    }
+    return true;
+  }
+
+  pragma "no doc"
+  proc _fileRegion() {
+    const end = min(_end, try! _file.length());
+    return (_start, max(_start, end));
+  }
+
+  // The path to open the file with on other locales, or "" if the
+  // file has none.
+  pragma "no doc"
+  proc _pathForLocales():string {
+    if numLocales == 1 then return "";
+    try {
+      return _file.path;
+    } catch {
+      return "";
+    }
+  }
+
+  pragma "no doc"
+  proc _numTasks(len:int(64)):int {
+    const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                     else dataParTasksPerLocale;
+    return max(1, min(numTasks, len / linesMinChunkBytes));
+  }
+
+  // A locale that is local to start..end-1, or 'dflt' if there is no
+  // such preference.
+  pragma "no doc"
+  proc _targetLocale(start:int(64), end:int(64), dflt:locale):locale {
+    const locs = _file.localesForRegion(start, end);
+    if locs.numIndices < numLocales && !locs.contains(dflt) {
+      for loc in locs do return loc;
+    }
+    return dflt;
+  }
+
+  // Divide start..end-1 into at most numChunks chunks of at least one
+  // byte each, moving each boundary after the first one forward to the
+  // start of the next item.  Returns the boundaries, one more than the
+  // number of chunks; an empty region is a single empty chunk.
+  pragma "no doc"
+  proc _alignedChunks(f:file, start:int(64), end:int(64), maxChunks:int,
+                      style:iostyle) {
+    const len = end - start;
+    const numChunks = max(1, min(maxChunks, len)):int;
+    var bounds:[0..numChunks] int(64);
+
+    bounds[0] = start;
+    bounds[numChunks] = end;
+    forall i in 1..numChunks-1 do
+      bounds[i] = _alignToItem(f, start + len * i / numChunks, end, style);
+
+    return bounds;
+  }
+
+  // Return the offset of the first item starting at or after 'offset',
+  // which must be past the start of the region.
+  pragma "no doc"
+  proc _alignToItem(f:file, offset:int(64), end:int(64),
+                    style:iostyle):int(64) {
+    var ret = end;
+    try {
+      var r = f.reader(locking=false, start=offset-1, end=end, hints=_hints);
+      try {
+        r.advancePastByte(style.string_end);
+        ret = r.offset();
+      } catch e: EOFError {
+      }
+      r.close();
+    } catch e {
+      halt("in ItemReader.these(): could not find the first item after ",
+           offset-1, " in ", f.tryGetPath(), ": ", e.message());
+    }
+    return ret;
+  }
+
+  pragma "no doc"
+  iter _itemsInRegion(f:file, start:int(64), end:int(64), style:iostyle) {
+    if start >= end then return;
+
+    // The parallel iterators cannot throw, so an error halts, naming the
+    // region this task was reading.
+    proc regionError(e:Error) {
+      halt("in ItemReader.these(): error reading offsets ", start, "..",
+           end-1, " of ", f.tryGetPath(), ": ", e.message());
+    }
+
+    var r:channel(false, kind, false);
+    try {
+      r = f.reader(kind, locking=false, start=start, end=end, hints=_hints,
+                   style=style);
+    } catch e {
+      regionError(e);
+    }
+    while true {
+      var x:ItemType;
+      var gotany:bool;
+      try {
+        gotany = r.read(x);
+      } catch e {
+        regionError(e);
+      }
+      if ! gotany then break;
+      yield x;
+    }
+    try {
+      r.close();
+    } catch e {
+      regionError(e);
+    }
+  }
 }
 
 /* Create and return an :record:`ItemReader` that can yield read values of
@@ -4487,6 +5002,255 @@ proc channel.itemWriter(type ItemType, param kind:iokind=iokind.dynamic) {
   return new ItemWriter(ItemType, kind, locking, this);
 }
 
+/*
+   The number of bytes that a :record:`TaskWriter` collects before
+   passing them on to its file.
+ */
+config const concurrentWriterFlushBytes = 64 * 1024;
+
+pragma "no doc"
+class _ConcurrentWriterState {
+  var f:file;
+  var next:atomic int(64);
+  var flushBytes:int;
+  var style:iostyle;
+  // The first error hit by a TaskWriter writing its remaining data from
+  // its deinit, which cannot throw, kept for ConcurrentWriter.check()
+  var deferredErrSet:atomic bool;
+  var deferredErr:syserr = ENOERR;
+  var deferredDetails:string;
+  var deferredChecked:bool;
+
+  proc deferError(e:SystemError) {
+    if !deferredErrSet.testAndSet() {
+      deferredErr = e.err;
+      deferredDetails = e.details;
+    }
+  }
+
+  proc deinit() {
+    // Report an error nobody asked about rather than lose it
+    if deferredErrSet.read() && !deferredChecked then
+      warning("a TaskWriter could not write its data: ",
+              SystemError.fromSyserr(deferredErr, deferredDetails).message());
+  }
+}
+
+/*
+   A :record:`ConcurrentWriter` allows many tasks to write to the same file
+   at once without contending for a channel lock.  Each task writes through
+   its own :record:`TaskWriter`, which collects what it writes in memory.
+   When a task writer has collected enough data, it reserves a region of
+   the file with a single atomic operation and writes all of the data to
+   that region at once.
+
+   Everything written by one call to :proc:`TaskWriter.write`,
+   :proc:`TaskWriter.writeln` or :proc:`TaskWriter.writef` ends up in one
+   contiguous piece of the file, but the pieces written by different tasks
+   are interleaved in the order in which they are passed on, so this is
+   suited to writing independent records such as log messages or lines of
+   a CSV file:
+
+   .. code-block:: chapel
+
+     var f = open("out.csv", iomode.cw);
+     var cw = f.concurrentWriter();
+     forall i in 1..n with (var w = cw.taskWriter()) do
+       w.writeln(i, ",", i*i);
+     // the task writers have passed on their data when the loop ends
+
+   A :record:`ConcurrentWriter` is created with :proc:`file.concurrentWriter`.
+ */
+record ConcurrentWriter {
+  /* the kind field for the channels of the task writers */
+  param kind:iokind;
+
+  pragma "no doc"
+  var _state:shared _ConcurrentWriterState;
+
+  /*
+     Create a :record:`TaskWriter` for use by the calling task.  It must be
+     called on the locale where the file was opened.
+
+     This does not throw, so that it can initialize a task-private
+     variable as in the example above.  It halts if the writer can not be
+     created, which only happens when out of memory.
+   */
+  proc taskWriter():TaskWriter(kind) {
+    if here != _state.f.home then
+      halt("ConcurrentWriter.taskWriter() must be called on the file's locale");
+
+    var ret:TaskWriter(kind);
+    ret._state = _state;
+    const err = qio_file_open_staging(ret._staging._file_internal,
+                                      _state.style);
+    if err then
+      halt("in ConcurrentWriter.taskWriter: ", errorToString(err));
+    ret._staging.home = here;
+    ret._ch = try! ret._staging.writer(kind, locking=false,
+                                        style=_state.style);
+    return ret;
+  }
+
+  /*
+     Return the offset just past the data written so far by all of the
+     task writers.
+   */
+  proc offset():int(64) {
+    return _state.next.read();
+  }
+
+  /*
+     Throw the first error that a :record:`TaskWriter` created by this
+     :record:`ConcurrentWriter` hit while writing its remaining data when
+     it went out of scope.  Errors from calls to :proc:`TaskWriter.flush`
+     and the other :record:`TaskWriter` methods are thrown by those calls
+     instead.  If such an error is never checked for, it is reported on
+     ``stderr`` once the :record:`ConcurrentWriter` and all of its task
+     writers are gone.
+
+     :throws SystemError: Thrown if a task writer could not write its data.
+   */
+  proc check() throws {
+    if _state.deferredErrSet.read() {
+      _state.deferredChecked = true;
+      throw SystemError.fromSyserr(_state.deferredErr,
+                                   _state.deferredDetails);
+    }
+  }
+}
+
+/*
+   Create a :record:`ConcurrentWriter` for this file.
+
+   :arg kind: :type:`iokind` compile-time argument to determine the
+              corresponding parameter of the :record:`TaskWriter` channels.
+              Defaults to ``iokind.dynamic``.
+   :arg start: the offset at which to start writing.  Defaults to 0.
+   :arg flushBytes: the number of bytes that each :record:`TaskWriter`
+                    collects before writing them to the file.  Defaults to
+                    :var:`concurrentWriterFlushBytes`.
+   :arg style: the :type:`iostyle` to use for the task writers.
+   :returns: a :record:`ConcurrentWriter` for this file.
+
+   :throws SystemError: Thrown if the file is not valid.
+ */
+proc file.concurrentWriter(param kind=iokind.dynamic, start:int(64) = 0,
+                           flushBytes:int = concurrentWriterFlushBytes,
+                           style:iostyle = this._style):
+                           ConcurrentWriter(kind) throws {
+  try check();
+
+  var ret:ConcurrentWriter(kind);
+  ret._state = new shared _ConcurrentWriterState(f=this, flushBytes=flushBytes,
+                                                 style=style);
+  ret._state.next.write(start);
+  return ret;
+}
+
+/*
+   A writer for use by a single task, created by
+   :proc:`ConcurrentWriter.taskWriter`.  The data written to it is
+   collected in memory and written to the file in large pieces.  Any data
+   that remains is written when the :record:`TaskWriter` goes out of scope,
+   or can be written earlier with :proc:`flush`.  An error while writing it
+   out of scope is kept for :proc:`ConcurrentWriter.check`.
+ */
+record TaskWriter {
+  /* the kind field for our channel */
+  param kind:iokind;
+
+  pragma "no doc"
+  var _state:shared _ConcurrentWriterState;
+  pragma "no doc"
+  var _staging:file;
+  pragma "no doc"
+  var _ch:channel(true, kind, false);
+
+  pragma "no doc"
+  proc deinit() {
+    if _state != nil {
+      try {
+        flush();
+      } catch e: SystemError {
+        _state.deferError(e);
+      } catch e {
+        halt("in TaskWriter.deinit: ", e.message());
+      }
+    }
+  }
+
+  /*
+     Write values as :proc:`channel.write` does.
+
+     :throws SystemError: Thrown if the values could not be written.
+   */
+  proc write(const args ...?k) throws {
+    try _ch.write((...args));
+    try _maybeFlush();
+  }
+
+  /*
+     Write values followed by a newline as :proc:`channel.writeln` does.
+
+     :throws SystemError: Thrown if the values could not be written.
+   */
+  proc writeln(const args ...?k) throws {
+    try _ch.writeln((...args));
+    try _maybeFlush();
+  }
+
+  /*
+     Write a newline.
+
+     :throws SystemError: Thrown if the newline could not be written.
+   */
+  proc writeln() throws {
+    try _ch.writeln();
+    try _maybeFlush();
+  }
+
+  /*
+     Write values with a format string as :proc:`channel.writef` does.
+
+     :throws SystemError: Thrown if the values could not be written.
+   */
+  proc writef(fmtStr:string, const args ...?k) throws {
+    try _ch.writef(fmtStr, (...args));
+    try _maybeFlush();
+  }
+
+  pragma "no doc"
+  proc writef(fmtStr:string) throws {
+    try _ch.writef(fmtStr);
+    try _maybeFlush();
+  }
+
+  /*
+     Write all of the data collected so far to the file.
+
+     :throws SystemError: Thrown if the data could not be written.
+   */
+  proc flush() throws {
+    try _ch.flush();
+    const len = qio_file_staged_length(_staging._file_internal);
+    if len == 0 then return;
+    const offset = _state.next.fetchAdd(len);
+    const err = qio_file_staged_pwrite(_staging._file_internal,
+                                       _state.f._file_internal, offset);
+    if err then
+      try ioerror(err, "in TaskWriter.flush", _state.f.tryGetPath(), offset);
+  }
+
+  pragma "no doc"
+  proc _maybeFlush() throws {
+    const pending = _ch._offset() -
+                    qio_file_staged_flushed(_staging._file_internal);
+    if pending >= _state.flushBytes then
+      try flush();
+  }
+}
+
 // And now, the toplevel items.
 
 /* standard input, otherwise known as file descriptor 0 */
@@ -4683,7 +5447,7 @@ proc file.localesForRegion(start:int(64), end:int(64)) {
 
   proc findloc(loc:string, locs:c_ptr(c_string), end:int) {
     for i in 0..end-1 {
-      if (loc == locs[i]) then
+      if (loc == locs[i]:string) then
         return true;
     }
     return false;
@@ -6389,7 +7153,8 @@ proc channel.writef(fmtStr: string, const args ...?k): bool throws {
   var err: syserr = ENOERR;
   on this.home {
     try! this.lock();
-    var fmt = fmtStr.localize().c_str();
+    const localFmtStr = fmtStr.localize();
+    var fmt = localFmtStr.c_str();
     var save_style = this._style();
     var cur:size_t = 0;
     var len:size_t = fmt.length:size_t;
@@ -6553,7 +7318,8 @@ proc channel.writef(fmtStr:string): bool throws {
   var err:syserr = ENOERR;
   on this.home {
     try! this.lock();
-    var fmt = fmtStr.localize().c_str();
+    const localFmtStr = fmtStr.localize();
+    var fmt = localFmtStr.c_str();
     var save_style = this._style();
     var cur:size_t = 0;
     var len:size_t = fmt.length:size_t;
@@ -6627,7 +7393,8 @@ proc channel.readf(fmtStr:string, ref args ...?k): bool throws {
   var err:syserr = ENOERR;
   on this.home {
     try! this.lock();
-    var fmt = fmtStr.localize().c_str();
+    const localFmtStr = fmtStr.localize();
+    var fmt = localFmtStr.c_str();
     var save_style = this._style();
     var cur:size_t = 0;
     var len:size_t = fmt.length:size_t;
@@ -6883,7 +7650,8 @@ proc channel.readf(fmtStr:string) throws {
   var err:syserr = ENOERR;
   on this.home {
     try! this.lock();
-    var fmt = fmtStr.localize().c_str();
+    const localFmtStr = fmtStr.localize();
+    var fmt = localFmtStr.c_str();
     var save_style = this._style();
     var cur:size_t = 0;
     var len:size_t = fmt.length:size_t;
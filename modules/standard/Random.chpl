@@ -144,6 +144,42 @@ module Random {
     compilerError("Random.fillRandom is only defined for numeric arrays");
   }
 
+  /*
+
+    Fill an array of `real` elements with pseudorandom values from the
+    normal distribution in parallel, using a new stream implementing
+    :class:`RandomStreamInterface` created specifically for this call.
+    The values are computed with the Box-Muller transform from the first
+    `2*arr.size` values of the stream.
+
+    :arg arr: The array to be filled
+    :type arr: `[] real`
+
+    :arg mean: The mean of the distribution
+    :arg stddev: The standard deviation of the distribution
+
+    :arg seed: The seed to use for the PRNG.  Defaults to
+     `oddCurrentTime` from :type:`RandomSupport.SeedGenerator`.
+    :type seed: `int(64)`
+
+    :arg algorithm: A param indicating which algorithm to use. Defaults to :param:`defaultRNG`.
+    :type algorithm: :type:`RNG`
+  */
+  proc fillRandomNormal(arr: [], mean: real = 0.0, stddev: real = 1.0,
+                        seed: int(64) = SeedGenerator.oddCurrentTime,
+                        param algorithm=defaultRNG)
+    where isRealType(arr.eltType) {
+    var randNums = makeRandomStream(seed, eltType=real, parSafe=false, algorithm=algorithm);
+    randNums.fillRandomNormal(arr, mean, stddev);
+  }
+
+  pragma "no doc"
+  proc fillRandomNormal(arr: [], mean: real = 0.0, stddev: real = 1.0,
+                        seed: int(64) = SeedGenerator.oddCurrentTime,
+                        param algorithm=defaultRNG) {
+    compilerError("Random.fillRandomNormal is only defined for real arrays");
+  }
+
   /* Shuffle the elements of an array into a random order.
 
      :arg arr: a 1-D non-strided array
@@ -302,7 +338,6 @@ module Random {
   proc _choiceProbabilities(stream, arr:[], size:?sizeType, replace, prob:?probType) throws
   {
     use Search only;
-    use Sort only;
 
     // If stride, offset, or size don't match, we're in trouble
     if arr.domain != prob.domain then
@@ -314,12 +349,12 @@ module Random {
     ref A = arr.reindex(1..arr.size);
     ref P = prob.reindex(1..arr.size);
 
-    // Construct cumulative sum array
-    var cumulativeArr = (+ scan P): real;
-
-    if !Sort.isSorted(cumulativeArr) then
+    if || reduce (P < 0) then
       throw new owned IllegalArgumentError("choice() prob array cannot contain negative values");
 
+    // Construct cumulative sum array
+    var cumulativeArr = _cumulativeSum(P);
+
     // Confirm the array has at least one value > 0
     if cumulativeArr[P.domain.last] <= 0 then
       throw new owned IllegalArgumentError('choice() prob array requires a value greater than 0');
@@ -349,8 +384,9 @@ module Random {
       var samples: [1..numElements] arr.eltType;
 
       if replace {
-        for sample in samples {
-          var randNum = stream.getNext(resultType=real);
+        forall (sample, randNum) in zip(samples,
+                                        stream.iterate(samples.domain,
+                                                       resultType=real)) {
           var (found, idx) = Search.binarySearch(cumulativeArr, randNum);
           sample = A[idx];
         }
@@ -361,7 +397,7 @@ module Random {
 
           // Recalculate normalized cumulativeArr
           if indicesChosen.size > 0 {
-            cumulativeArr = (+ scan P): real;
+            cumulativeArr = _cumulativeSum(P);
             total = cumulativeArr[P.domain.last];
             cumulativeArr /= total;
           }
@@ -388,6 +424,50 @@ module Random {
     }
   }
 
+  pragma "no doc"
+  /* Box-Muller transform of uniform values u1 in (0, 1] and u2 in [0, 1]
+     to a value from the normal distribution */
+  inline proc _boxMuller(u1: real, u2: real, mean: real, stddev: real) {
+    return mean + stddev * sqrt(-2.0 * log(u1)) * cos(2.0 * pi * u2);
+  }
+
+  pragma "no doc"
+  /* Parallel inclusive prefix sum of a 1-D array, as reals.  Each task
+     scans its chunk, the chunk totals are scanned serially, and then each
+     task adds the total of the chunks before it to its chunk. */
+  proc _cumulativeSum(P: [?D]) {
+    use RangeChunk;
+
+    const r = D.dim(1);
+    const numTasks = max(1, min(r.size,
+                                if dataParTasksPerLocale == 0
+                                  then here.maxTaskPar
+                                  else dataParTasksPerLocale));
+    var C: [D] real;
+    var chunkTotal: [0..#numTasks] real;
+
+    coforall t in 0..#numTasks {
+      var sum = 0.0;
+      for i in chunk(r, numTasks, t) {
+        sum += P[i]:real;
+        C[i] = sum;
+      }
+      chunkTotal[t] = sum;
+    }
+
+    var offset: [0..#numTasks] real;
+    for t in 1..numTasks-1 do
+      offset[t] = offset[t-1] + chunkTotal[t-1];
+
+    coforall t in 1..numTasks-1 {
+      const myOffset = offset[t];
+      for i in chunk(r, numTasks, t) do
+        C[i] += myOffset;
+    }
+
+    return C;
+  }
+
   /*
 
     Models a stream of pseudorandom numbers.  This class is defined for
@@ -506,6 +586,22 @@ module Random {
       compilerError("RandomStreamInterface.fillRandom called");
     }
 
+    /*
+      Fill the argument array with pseudorandom values from the normal
+      distribution.  This method is identical to the standalone
+      :proc:`fillRandomNormal` procedure, except that it consumes random
+      values from the :class:`RandomStreamInterface` object on which it's
+      invoked rather than creating a new stream for the purpose of the call.
+
+      :arg arr: The array to be filled
+      :type arr: [] `real`
+      :arg mean: The mean of the distribution
+      :arg stddev: The standard deviation of the distribution
+     */
+    proc fillRandomNormal(arr: [] ?t, mean: real = 0.0, stddev: real = 1.0) {
+      compilerError("RandomStreamInterface.fillRandomNormal called");
+    }
+
 
     /*
      Returns a random sample from a given 1-D array, ``arr``.
@@ -661,6 +757,12 @@ module Random {
       else return (numBits(t)+31) / 32;
     }
 
+    //
+    // Number of elements per bucket in the parallel shuffle.  Smaller
+    // arrays are shuffled serially.
+    //
+    private param shuffleBucketSize = 1 << 16;
+
     /*
 
       Models a stream of pseudorandom numbers generated by the PCG random number
@@ -939,8 +1041,33 @@ module Random {
         :type arr: [] :type:`eltType`
       */
       proc fillRandom(arr: [] eltType) {
-        forall (x, r) in zip(arr, iterate(arr.domain, arr.eltType)) do
-          x = r;
+        if parSafe then
+          PCGRandomStreamPrivate_lock$ = true;
+        const start = PCGRandomStreamPrivate_count;
+        PCGRandomStreamPrivate_count += arr.size.safeCast(int(64));
+        PCGRandomStreamPrivate_skipToNth_noLock(PCGRandomStreamPrivate_count);
+        if parSafe then
+          PCGRandomStreamPrivate_lock$;
+        forall followThis in PCGRandomPrivate_chunks(arr.domain) do
+          PCGRandomPrivate_fill(arr, seed, start, followThis);
+      }
+
+      /*
+        Fill the argument array with pseudorandom values from the normal
+        distribution with the given mean and standard deviation.  Each
+        value is computed from two uniform values with the Box-Muller
+        transform, so this consumes `2*arr.size` values from the stream.
+
+        :arg arr: The array to be filled
+        :type arr: [] `real`
+        :arg mean: The mean of the distribution
+        :arg stddev: The standard deviation of the distribution
+      */
+      proc fillRandomNormal(arr: [] ?t, mean: real = 0.0, stddev: real = 1.0)
+          where isRealType(t) {
+        forall (x, r1, r2) in zip(arr, iterate(arr.domain, uint(64)),
+                                  iterate(arr.domain, real(64))) do
+          x = _boxMuller(randToOpenReal64(r1), r2, mean, stddev):t;
       }
 
       /*
@@ -977,12 +1104,30 @@ module Random {
         return _choice(this, arr, size=size, replace=replace, prob=prob);
       }
 
-      /* Randomly shuffle a 1-D array. */
+      /* Randomly shuffle a 1-D array.
+
+         Arrays with at least 2**16 elements are shuffled in parallel,
+         including distributed arrays. The result depends only on the
+         stream's seed and position and on the size of the array, not on
+         the number of tasks or locales used.
+       */
       proc shuffle(arr: [?D] ?eltType ) {
 
         if D.rank != 1 then
           compilerError("Shuffle requires 1-D array");
 
+        if D.size >= shuffleBucketSize {
+          if parSafe then
+            PCGRandomStreamPrivate_lock$ = true;
+          const start = PCGRandomStreamPrivate_count;
+          PCGRandomStreamPrivate_count += 2 * D.size.safeCast(int(64));
+          PCGRandomStreamPrivate_skipToNth_noLock(PCGRandomStreamPrivate_count);
+          if parSafe then
+            PCGRandomStreamPrivate_lock$;
+          PCGRandomPrivate_parallelShuffle(arr, seed, start);
+          return;
+        }
+
         const low = D.low,
               high = D.high,
               stride = D.stride;
@@ -1024,6 +1169,8 @@ module Random {
       /* Produce a random permutation, storing it in a 1-D array.
          The resulting array will include each value from low..high
          exactly once, where low and high refer to the array's domain.
+
+         As with :proc:`shuffle`, large arrays are permuted in parallel.
          */
       proc permutation(arr: [] eltType) {
         var low = arr.domain.dim(1).low;
@@ -1034,6 +1181,13 @@ module Random {
         //if arr.domain.dim(1).stridable then
         //  compilerError("Permutation requires non-stridable 1-D array");
 
+        if arr.size >= shuffleBucketSize {
+          forall (x, i) in zip(arr, arr.domain) do
+            x = i;
+          shuffle(arr);
+          return;
+        }
+
         if parSafe then
           PCGRandomStreamPrivate_lock$ = true;
 
@@ -1141,7 +1295,14 @@ module Random {
     private inline
     proc randToReal64(x: uint(64)):real(64)
     {
-      return ldexp(x:real(64), -64);
+      return x:real(64) * 0x1p-64;
+    }
+    // returns a random number in (0, 1]
+    // where the number is a multiple of 2**-53
+    private inline
+    proc randToOpenReal64(x: uint(64)):real(64)
+    {
+      return ((x >> 11) + 1):real(64) * 0x1p-53;
     }
     // returns a random number in [min, max]
     // by scaling a multiple of 2**-64 by (max-min)
@@ -1157,7 +1318,7 @@ module Random {
     private inline
     proc randToReal32(x: uint(32))
     {
-      return ldexp(x:real(32), -32);
+      return x:real(32) * 0x1p-32:real(32);
     }
 
     // returns a random number in [min, max)
@@ -1271,35 +1432,50 @@ module Random {
 
       checkSufficientBitsAndAdvanceOthers(resultType, states);
 
+      var outputs: numGenerators(resultType) * uint(32);
+      for param i in 1..outputs.size do
+        outputs[i] = states[i].random(pcg_getvalid_inc(i));
+      return randFromOutputs(resultType, outputs);
+    }
+
+    // Build a value of resultType from the next 32-bit output of each of
+    // the RNGs it needs, as rand32_1 etc. would
+    private inline
+    proc randFromOutputs(type resultType, outputs) {
       if resultType == complex(128) {
-        return (randToReal64(rand64_1(states)),
-                randToReal64(rand64_2(states))):complex(128);
+        return (randToReal64(join64(outputs[1], outputs[2])),
+                randToReal64(join64(outputs[3], outputs[4]))):complex(128);
       } else if resultType == complex(64) {
-        return (randToReal32(rand32_1(states)),
-                randToReal32(rand32_2(states))):complex(64);
+        return (randToReal32(outputs[1]),
+                randToReal32(outputs[2])):complex(64);
       } else if resultType == imag(64) {
-        return _r2i(randToReal64(rand64_1(states)));
+        return _r2i(randToReal64(join64(outputs[1], outputs[2])));
       } else if resultType == imag(32) {
-        return _r2i(randToReal32(rand32_1(states)));
+        return _r2i(randToReal32(outputs[1]));
       } else if resultType == real(64) {
-        return randToReal64(rand64_1(states));
+        return randToReal64(join64(outputs[1], outputs[2]));
       } else if resultType == real(32) {
-        return randToReal32(rand32_1(states));
+        return randToReal32(outputs[1]);
       } else if resultType == uint(64) || resultType == int(64) {
-        return rand64_1(states):resultType;
+        return join64(outputs[1], outputs[2]):resultType;
       } else if resultType == uint(32) || resultType == int(32) {
-        return rand32_1(states):resultType;
+        return outputs[1]:resultType;
       } else if(resultType == uint(16) ||
                 resultType == int(16)) {
-        return (rand32_1(states) >> 16):resultType;
+        return (outputs[1] >> 16):resultType;
       } else if(resultType == uint(8) ||
                 resultType == int(8)) {
-        return (rand32_1(states) >> 24):resultType;
+        return (outputs[1] >> 24):resultType;
       } else if isBoolType(resultType) {
-        return (rand32_1(states) >> 31) != 0;
+        return (outputs[1] >> 31) != 0;
       }
     }
 
+    private inline
+    proc join64(hi:uint(32), lo:uint(32)):uint(64) {
+      return (hi:uint(64) << 32) | lo;
+    }
+
     // returns x with min <= x <= max (for integers)
     // and min <= x < max (for real/complex/imag)
     // seed should be the initial seed of the RNG
@@ -1357,6 +1533,207 @@ module Random {
       return states;
     }
 
+    //
+    // The runs of consecutive positions of the 1-D array 'arr' that are
+    // each stored on one locale, in order, as (first position, size,
+    // locale).  They come from the local subdomains of its domain.  If
+    // those are not contiguous, as for a Cyclic distribution, the
+    // positions are split evenly between the target locales instead, and
+    // each run goes to the locale owning its first element.
+    //
+    private proc PCGRandomPrivate_shuffleSegments(arr: [?D]) {
+      use RangeChunk, Sort;
+
+      record firstPosition {
+        proc key(seg) return seg(1);
+      }
+
+      const r = D.dim(1);
+      const n = r.size;
+      var segs: [0..-1] (int, int, locale);
+      var contiguous = true;
+      for loc in D.targetLocales() do on loc {
+        for sub in D.localSubdomains() {
+          const s = sub.dim(1);
+          if s.size == 0 then continue;
+          if s.stride != r.stride then
+            contiguous = false;
+          else
+            segs.push_back((r.indexOrder(s.first), s.size, loc));
+        }
+      }
+
+      if contiguous && (+ reduce [seg in segs] seg(2)) == n {
+        sort(segs, new firstPosition());
+        return segs;
+      }
+
+      const numLocs = D.targetLocales().size;
+      var even: [0..-1] (int, int, locale);
+      for i in 0..#numLocs {
+        const pos = chunk(0..#n, numLocs, i);
+        if pos.size > 0 then
+          even.push_back((pos.low, pos.size,
+                          arr[r.orderToIndex(pos.low)].locale));
+      }
+      return even;
+    }
+
+    //
+    // Shuffle 'arr' in parallel using the stream values at positions
+    // start..#2*arr.size.  Each element is sent to a random bucket (with
+    // a stable counting sort), then the buckets are shuffled in parallel
+    // with Fisher-Yates.  Since the buckets are random subsets that are
+    // then uniformly shuffled, the result is a uniform permutation (see
+    // Sanders, "Random Permutations on Distributed, External and
+    // Hierarchical Memory", 1998).
+    //
+    // The work follows the segments of the array stored on each locale
+    // (see PCGRandomPrivate_shuffleSegments), each split between the tasks
+    // of its locale.  The per-segment bucket counts are spread over the
+    // target locales by bucket, so that adding them up runs in parallel
+    // where they are stored.
+    //
+    private proc PCGRandomPrivate_parallelShuffle(arr: [?D], seed: int(64),
+                                                  start: int(64)) {
+      use RangeChunk, BlockDist;
+
+      const r = D.dim(1);
+      const n = r.size;
+      const numBuckets = n / shuffleBucketSize;
+      const numTasks = if dataParTasksPerLocale == 0 then here.maxTaskPar
+                       else dataParTasksPerLocale;
+      const segs = PCGRandomPrivate_shuffleSegments(arr);
+      const numSegs = segs.size;
+      const targetLocs = D.targetLocales();
+
+      // The modulo is biased by at most numBuckets/2**64, which is
+      // negligible.
+      var bucket: [D] int(32);
+      forall (b, x) in zip(bucket, PCGRandomPrivate_iterate(uint, D, seed,
+                                                            start)) do
+        b = (x % numBuckets:uint):int(32);
+
+      // cnt[b, t] is the number of elements the t-th task of the segment
+      // at positions lo..#size sends to bucket b.  This only reads the
+      // segment's own elements, so it is recomputed when needed rather
+      // than kept between the passes below.
+      proc taskCounts(lo: int, size: int) {
+        const nTasks = min(numTasks, size);
+        var cnt: [0..#numBuckets, 0..#nTasks] int;
+        coforall t in 0..#nTasks {
+          for pos in chunk(lo..#size, nTasks, t) do
+            cnt[bucket[r.orderToIndex(pos)], t] += 1;
+        }
+        return cnt;
+      }
+
+      // counts[b*numSegs + s] is the number of elements segment s sends to
+      // bucket b, and then where the first of them goes
+      const countsSpace = {0..#numBuckets*numSegs},
+            bucketSpace = {0..#numBuckets};
+      const countsDom = countsSpace dmapped Block(countsSpace,
+                                                  targetLocales=targetLocs),
+            bucketDom = bucketSpace dmapped Block(bucketSpace,
+                                                  targetLocales=targetLocs);
+      var counts: [countsDom] int;
+      var bucketStart: [bucketDom] int;
+
+      coforall s in 0..#numSegs {
+        const (lo, size, loc) = segs[s];
+        on loc {
+          const cnt = taskCounts(lo, size);
+          forall b in 0..#numBuckets do
+            counts[b*numSegs + s] = + reduce cnt[b, ..];
+        }
+      }
+
+      forall b in bucketDom {
+        var total = 0;
+        for s in 0..#numSegs do
+          total += counts[b*numSegs + s];
+        bucketStart[b] = total;
+      }
+
+      // Turn the totals into where each bucket starts: each locale scans the
+      // buckets it stores, starting after those of the locales before it.
+      const bucketLocs = bucketDom.targetLocales();
+      var locTotals: [bucketLocs.domain] int;
+      coforall (loc, total) in zip(bucketLocs, locTotals) do on loc {
+        for b in bucketDom.localSubdomain() do
+          total += bucketStart[b];
+      }
+      coforall (loc, l) in zip(bucketLocs, bucketLocs.domain) do on loc {
+        var next = 0;
+        for prev in bucketLocs.domain.low..l-1 do
+          next += locTotals[prev];
+        for b in bucketDom.localSubdomain() {
+          const total = bucketStart[b];
+          bucketStart[b] = next;
+          next += total;
+        }
+      }
+
+      forall b in bucketDom {
+        var next = bucketStart[b];
+        for s in 0..#numSegs {
+          const cnt = counts[b*numSegs + s];
+          counts[b*numSegs + s] = next;
+          next += cnt;
+        }
+      }
+
+      var tmp: [D] arr.eltType;
+      coforall s in 0..#numSegs {
+        const (lo, size, loc) = segs[s];
+        on loc {
+          var next = taskCounts(lo, size);
+          const nTasks = next.domain.dim(2).size;
+          forall b in 0..#numBuckets {
+            var first = counts[b*numSegs + s];
+            for t in 0..#nTasks {
+              const cnt = next[b, t];
+              next[b, t] = first;
+              first += cnt;
+            }
+          }
+          coforall t in 0..#nTasks {
+            for pos in chunk(lo..#size, nTasks, t) {
+              const i = r.orderToIndex(pos);
+              const b = bucket[i];
+              tmp[r.orderToIndex(next[b, t])] = arr[i];
+              next[b, t] += 1;
+            }
+          }
+        }
+      }
+
+      // Each bucket is shuffled on the locale storing its first element
+      coforall s in 0..#numSegs {
+        const (lo, size, loc) = segs[s];
+        on loc {
+          const starts: [0..#numBuckets] int = bucketStart;
+          forall b in 0..#numBuckets {
+            const bucketLo = starts[b];
+            if lo <= bucketLo && bucketLo < lo + size {
+              const bucketSize = (if b == numBuckets-1 then n
+                                  else starts[b+1]) - bucketLo;
+              const first = start + n + bucketLo;
+              var cursor = randlc_skipto(int, seed, first);
+              for i in 0..#bucketSize by -1 {
+                const j = randlc_bounded(int, cursor, seed,
+                                         first + bucketSize - 1 - i, 0, i);
+                tmp[r.orderToIndex(bucketLo+i)] <=>
+                  tmp[r.orderToIndex(bucketLo+j)];
+              }
+            }
+          }
+        }
+      }
+
+      arr = tmp;
+    }
+
     //
     // iterate over outer ranges in tuple of ranges
     //
@@ -1373,6 +1750,112 @@ module Random {
       }
     }
 
+    //
+    // Number of RNG states the bulk fill steps together
+    //
+    private param numLanes = 8;
+
+    //
+    // Fill the elements of 'arr' in the chunk 'followThis' (of the
+    // zero-based version of its domain) with values from the stream, where
+    // the first element of 'arr' gets the value at position 'start'.  This
+    // has the same result as zippering 'arr' with PCGRandomPrivate_iterate()
+    // but computes consecutive values numLanes at a time: lane l holds the
+    // RNG states for the l-th of them and jumps numLanes positions per
+    // batch.  The lanes are independent, so each batch can be vectorized.
+    //
+    private proc PCGRandomPrivate_fill(arr: [?D], seed: int(64),
+                                       start: int(64), followThis) {
+      type resultType = arr.eltType;
+      param numGen = numGenerators(resultType);
+      const ZD = computeZeroBasedDomain(D);
+      const innerRange = followThis(ZD.rank);
+      const innerDim = D.dim(D.rank);
+
+      for outer in outer(followThis) {
+        var myStart = start;
+        if ZD.rank > 1 then
+          myStart += ZD.indexOrder(((...outer), innerRange.low)).safeCast(int(64));
+        else
+          myStart += ZD.indexOrder(innerRange.low).safeCast(int(64));
+
+        var ind: D.rank*D.idxType;
+        for param d in 1..D.rank-1 do
+          ind[d] = D.dim(d).orderToIndex(outer[d]);
+
+        if innerRange.stridable {
+          myStart -= innerRange.low.safeCast(int(64));
+          for i in innerRange {
+            var cursor = randlc_skipto(resultType, seed, myStart + i.safeCast(int(64)));
+            ind[D.rank] = innerDim.orderToIndex(i);
+            arr[ind] = randlc(resultType, cursor);
+          }
+          continue;
+        }
+
+        const count = innerRange.size;
+        const numBatches = count / numLanes;
+        var i = innerRange.low;
+
+        if numBatches > 0 {
+          var lanes: numLanes * (numGen * pcg_setseq_64_xsh_rr_32_rng);
+          var jump: numGen * (2 * uint(64));
+          var cursor = randlc_skipto(resultType, seed, myStart);
+          for param g in 1..numGen do
+            jump[g] = cursor[g].jump_constants(pcg_getvalid_inc(g), numLanes);
+          for l in 1..numLanes {
+            lanes[l] = cursor;
+            for param g in 1..numGen do
+              cursor[g].random(pcg_getvalid_inc(g));
+          }
+
+          var outputs: numLanes * (numGen * uint(32));
+          for 1..numBatches {
+            for param g in 1..numGen {
+              const (mult, plus) = jump[g];
+              for param l in 1..numLanes do
+                outputs[l][g] = lanes[l][g].jump_random(mult, plus);
+            }
+            for l in 1..numLanes {
+              ind[D.rank] = innerDim.orderToIndex(i);
+              arr[ind] = randFromOutputs(resultType, outputs[l]);
+              i += 1;
+            }
+          }
+        }
+
+        const done = numBatches * numLanes;
+        var cursor = randlc_skipto(resultType, seed, myStart + done);
+        for 1..count-done {
+          ind[D.rank] = innerDim.orderToIndex(i);
+          arr[ind] = randlc(resultType, cursor);
+          i += 1;
+        }
+      }
+    }
+
+    //
+    // A forall over this yields each chunk of D's leader iterator once,
+    // so that it can be handed to PCGRandomPrivate_fill()
+    //
+    pragma "no doc"
+    iter PCGRandomPrivate_chunks(D: domain) {
+      yield computeZeroBasedDomain(D).dims();
+    }
+
+    pragma "no doc"
+    iter PCGRandomPrivate_chunks(D: domain, param tag: iterKind)
+          where tag == iterKind.leader {
+      for block in D.these(tag=iterKind.leader) do
+        yield block;
+    }
+
+    pragma "no doc"
+    iter PCGRandomPrivate_chunks(D: domain, param tag: iterKind, followThis)
+          where tag == iterKind.follower {
+      yield followThis;
+    }
+
     //
     // PCGRandomStream iterator implementation
     //
@@ -1778,6 +2261,37 @@ module Random {
         // this is pcg_setseq_64_advance_r
         state = pcg_advance_lcg(64, state, delta, PCG_DEFAULT_MULTIPLIER_64, inc);
       }
+
+      /* Compute the multiplier and increment that jump the RNG state
+         `delta` steps ahead, for use with :proc:`jump_random`.
+
+         :arg inc: The sequence constant (same as passed to `srandom`)
+         :arg delta: The number of steps to jump ahead
+         :returns: a (multiplier, increment) tuple
+       */
+      proc jump_constants(inc:uint(64), delta:uint(64)) {
+        const plus = pcg_advance_lcg(64, 0, delta,
+                                     PCG_DEFAULT_MULTIPLIER_64, inc);
+        const mult = pcg_advance_lcg(64, 1, delta,
+                                     PCG_DEFAULT_MULTIPLIER_64, inc) - plus;
+        return (mult, plus);
+      }
+
+      /* Get the next 32-bit random number and then jump the state ahead by
+         the number of steps `mult` and `plus` were computed for. Several
+         RNGs that are a fixed number of steps apart can use this to produce
+         interleaved parts of one sequence independently.
+
+         :arg mult: The multiplier from :proc:`jump_constants`
+         :arg plus: The increment from :proc:`jump_constants`
+         :returns: 32 bits generated by the RNG.
+       */
+      inline proc jump_random(mult:uint(64), plus:uint(64)):uint(32)
+      {
+        const oldstate:uint(64) = state;
+        state = state * mult + plus;
+        return pcg_output_xsh_rr_64_32(oldstate);
+      }
     }
 
     /*
@@ -2444,8 +2958,33 @@ module Random {
         :type arr: [] :type:`eltType`
       */
       proc fillRandom(arr: [] eltType) {
-        forall (x, r) in zip(arr, iterate(arr.domain, arr.eltType)) do
-          x = r;
+        if parSafe then
+          NPBRandomStreamPrivate_lock$ = true;
+        const start = NPBRandomStreamPrivate_count;
+        NPBRandomStreamPrivate_count += arr.size.safeCast(int(64));
+        NPBRandomStreamPrivate_skipToNth_noLock(NPBRandomStreamPrivate_count);
+        if parSafe then
+          NPBRandomStreamPrivate_lock$;
+        forall followThis in NPBRandomPrivate_chunks(arr.domain) do
+          NPBRandomPrivate_fill(arr, seed, start, followThis);
+      }
+
+      /*
+        Fill the argument array with pseudorandom values from the normal
+        distribution with the given mean and standard deviation.  Each
+        value is computed from two uniform values with the Box-Muller
+        transform, so this consumes `2*arr.size` values from the stream.
+
+        :arg arr: The array to be filled
+        :type arr: [] `real`
+        :arg mean: The mean of the distribution
+        :arg stddev: The standard deviation of the distribution
+      */
+      proc fillRandomNormal(arr: [] ?t, mean: real = 0.0, stddev: real = 1.0)
+          where isRealType(t) {
+        forall (x, r1, r2) in zip(arr, iterate(arr.domain, real),
+                                  iterate(arr.domain, real)) do
+          x = _boxMuller(r1, r2, mean, stddev):t;
       }
 
       pragma "no doc"
@@ -2619,6 +3158,117 @@ module Random {
       }
     }
 
+    //
+    // Number of cursors the bulk fill steps together
+    //
+    private param numLanes = 8;
+
+    //
+    // Fill the elements of 'arr' in the chunk 'followThis' (of the
+    // zero-based version of its domain) with values from the stream, where
+    // the first element of 'arr' gets the value at position 'start'.  This
+    // has the same result as zippering 'arr' with NPBRandomPrivate_iterate()
+    // but computes consecutive values numLanes at a time: lane l holds the
+    // cursor for the l-th of them and jumps numLanes positions per batch by
+    // multiplying by arand**numLanes.  The lanes are independent, so each
+    // batch can be vectorized.
+    //
+    private proc NPBRandomPrivate_fill(arr: [?D], seed: int(64),
+                                       start: int(64), followThis) {
+      type resultType = arr.eltType;
+      param multiplier = if resultType == complex then 2 else 1;
+      const ZD = computeZeroBasedDomain(D);
+      const innerRange = followThis(ZD.rank);
+      const innerDim = D.dim(D.rank);
+
+      var jumpMult = arand;
+      for 2..numLanes do
+        randlc(jumpMult, arand);
+
+      for outer in outer(followThis) {
+        var myStart = start;
+        if ZD.rank > 1 then
+          myStart += multiplier * ZD.indexOrder(((...outer), innerRange.low)).safeCast(int(64));
+        else
+          myStart += multiplier * ZD.indexOrder(innerRange.low).safeCast(int(64));
+
+        var ind: D.rank*D.idxType;
+        for param d in 1..D.rank-1 do
+          ind[d] = D.dim(d).orderToIndex(outer[d]);
+
+        if innerRange.stridable {
+          myStart -= innerRange.low.safeCast(int(64));
+          for i in innerRange {
+            var cursor = randlc_skipto(seed, myStart + i.safeCast(int(64)) * multiplier);
+            ind[D.rank] = innerDim.orderToIndex(i);
+            arr[ind] = randlc(resultType, cursor);
+          }
+          continue;
+        }
+
+        const count = multiplier * innerRange.size;
+        const numBatches = count / numLanes;
+        var i = innerRange.low;
+
+        if numBatches > 0 {
+          var lanes: numLanes * real;
+          var cursor = randlc_skipto(seed, myStart);
+          for l in 1..numLanes {
+            randlc(cursor);
+            lanes[l] = cursor;
+          }
+
+          var outputs: numLanes * real;
+          for 1..numBatches {
+            for param l in 1..numLanes {
+              outputs[l] = r46 * lanes[l];
+              randlc(lanes[l], jumpMult);
+            }
+            for l in 1..numLanes by multiplier {
+              ind[D.rank] = innerDim.orderToIndex(i);
+              if resultType == complex then
+                arr[ind] = (outputs[l], outputs[l+1]):complex;
+              else if resultType == imag then
+                arr[ind] = _r2i(outputs[l]);
+              else
+                arr[ind] = outputs[l];
+              i += 1;
+            }
+          }
+        }
+
+        const done = numBatches * numLanes;
+        var cursor = randlc_skipto(seed, myStart + done);
+        for 1..(count-done)/multiplier {
+          ind[D.rank] = innerDim.orderToIndex(i);
+          arr[ind] = randlc(resultType, cursor);
+          i += 1;
+        }
+      }
+    }
+
+    //
+    // A forall over this yields each chunk of D's leader iterator once,
+    // so that it can be handed to NPBRandomPrivate_fill()
+    //
+    pragma "no doc"
+    iter NPBRandomPrivate_chunks(D: domain) {
+      yield computeZeroBasedDomain(D).dims();
+    }
+
+    pragma "no doc"
+    iter NPBRandomPrivate_chunks(D: domain, param tag: iterKind)
+          where tag == iterKind.leader {
+      for block in D.these(tag=iterKind.leader) do
+        yield block;
+    }
+
+    pragma "no doc"
+    iter NPBRandomPrivate_chunks(D: domain, param tag: iterKind, followThis)
+          where tag == iterKind.follower {
+      yield followThis;
+    }
+
     //
     // RandomStream iterator implementation
     //
@@ -89,6 +89,80 @@ void chpl_gen_comm_prefetch(c_nodeid_t node, void* raddr,
 }
 
 
+//
+// Buffered GETs for loops that read consecutive remote array elements
+// (see compiler/optimizations/bulkRemoteReads.cpp).  The first remote
+// read through a handle allocates a read-ahead window and every read
+// that falls outside of the window refills it with a single GET that
+// covers as much of [raddr, rlast] as fits.  The returned pointer is
+// only valid until the next call with the same handle.  The handle is
+// released by chpl_gen_comm_get_buffer_free() once the loop is done.
+//
+#define CHPL_COMM_GET_BUFFER_SIZE (64 * 1024)
+
+typedef struct {
+  c_nodeid_t node;
+  char*      rstart;
+  size_t     len;
+  size_t     cap;
+  char       data[];
+} chpl_comm_get_buffer_t;
+
+static inline
+void* chpl_gen_comm_get_buffered(c_nodeid_t node, void* raddr, void* rlast,
+                                 size_t size, int32_t typeIndex,
+                                 void** handle, int ln, int32_t fn)
+{
+  chpl_comm_get_buffer_t* buf = (chpl_comm_get_buffer_t*) *handle;
+  char* r = (char*) raddr;
+  size_t len;
+
+  if (chpl_nodeID == node) {
+    return raddr;
+  }
+
+  if (buf != NULL && buf->node == node && r >= buf->rstart &&
+      r + size <= buf->rstart + buf->len) {
+    return buf->data + (r - buf->rstart);
+  }
+
+  if (buf == NULL) {
+    size_t cap = (size > CHPL_COMM_GET_BUFFER_SIZE) ?
+                 size : CHPL_COMM_GET_BUFFER_SIZE;
+
+    buf = (chpl_comm_get_buffer_t*)
+          chpl_mem_alloc(sizeof(chpl_comm_get_buffer_t) + cap,
+                         CHPL_RT_MD_COMM_UTIL, ln, fn);
+    buf->cap = cap;
+    *handle = buf;
+  }
+
+  // Never read past the last element the loop will touch.
+  len = buf->cap - buf->cap % size;
+  if ((char*) rlast < r) {
+    len = size;
+  } else if ((size_t) ((char*) rlast - r) + size < len) {
+    len = (size_t) ((char*) rlast - r) + size;
+  }
+
+  chpl_gen_comm_get(buf->data, node, raddr, len, typeIndex,
+                    CHPL_COMM_UNKNOWN_ID, ln, fn);
+  buf->node = node;
+  buf->rstart = r;
+  buf->len = len;
+
+  return buf->data;
+}
+
+static inline
+void chpl_gen_comm_get_buffer_free(void** handle, int ln, int32_t fn)
+{
+  if (*handle != NULL) {
+    chpl_mem_free(*handle, ln, fn);
+    *handle = NULL;
+  }
+}
+
 static inline
 void chpl_gen_comm_put(void* addr, c_nodeid_t node, void* raddr,
                        size_t size, int32_t typeIndex,
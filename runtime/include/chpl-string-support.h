@@ -78,4 +78,15 @@ int string_index_of(c_string x, c_string y);
 c_string string_index(c_string x, int i, int32_t lineno, int32_t filename);
 c_string string_select(c_string x, int low, int high, int stride, int32_t lineno, int32_t filename);
 
+// Search and hash a buffer of bytes that need not be NUL-terminated.
+// The search functions return a 0-based offset, or -1 if the needle is not
+// found.  chpl_bytes_count counts overlapping occurrences.
+int64_t chpl_bytes_find(const uint8_t* haystack, int64_t hlen,
+                        const uint8_t* needle, int64_t nlen);
+int64_t chpl_bytes_rfind(const uint8_t* haystack, int64_t hlen,
+                         const uint8_t* needle, int64_t nlen);
+int64_t chpl_bytes_count(const uint8_t* haystack, int64_t hlen,
+                         const uint8_t* needle, int64_t nlen);
+uint64_t chpl_bytes_hash(const uint8_t* buf, int64_t len);
+
 #endif
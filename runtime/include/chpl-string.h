@@ -35,13 +35,23 @@ chpl_string chpl_wide_string_copy(struct chpl_chpl____wide_chpl_string_s* x, int
 void chpl_string_widen(struct chpl_chpl____wide_chpl_string_s* x, chpl_string from, int32_t lineno, int32_t filename);
 void chpl_comm_wide_get_string(chpl_string* local, struct chpl_chpl____wide_chpl_string_s* x, int32_t tid, int32_t lineno, int32_t filename);
 
-#define CHPL_SHORT_STRING_SIZE 8
+// Chapel strings shorter than this many bytes keep their data, including
+// the terminating NUL, in a chpl__inPlaceBuffer within the string record
+// rather than in a separate heap buffer.
+#define CHPL_SHORT_STRING_SIZE 16
 
 typedef struct chpl__inPlaceBuffer_t {
   uint8_t data[CHPL_SHORT_STRING_SIZE];
 } chpl__inPlaceBuffer;
 
-uint8_t* chpl__getInPlaceBufferData(chpl__inPlaceBuffer* buf);
-uint8_t* chpl__getInPlaceBufferDataForWrite(chpl__inPlaceBuffer* buf);
+static inline
+uint8_t* chpl__getInPlaceBufferData(chpl__inPlaceBuffer* buf) {
+  return buf->data;
+}
+
+static inline
+uint8_t* chpl__getInPlaceBufferDataForWrite(chpl__inPlaceBuffer* buf) {
+  return buf->data;
+}
 
 #endif
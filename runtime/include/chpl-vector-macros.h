@@ -31,11 +31,12 @@
 #elif RT_COMP_CC == RT_COMP_INTEL && RT_COMP_INTEL_VERSION >= 900
 #define CHPL_PRAGMA_IVDEP _Pragma ("ivdep")
 
-// I didn't find an equivalent for clang version 3.6 (released 2015.) They have
-// a vectorize pragma, but that just manually enables/disables vectorization on
-// a specific loop, it doesn't provide the compiler with any more information
+// Clang has no ivdep, but since version 3.8 (released 2016) its loop
+// vectorize pragma accepts assume_safety, which tells the vectorizer to
+// ignore memory dependencies between iterations. That is what the LLVM
+// backend conveys with llvm.mem.parallel_loop_access metadata.
 #elif RT_COMP_CC == RT_COMP_CLANG
-#define CHPL_PRAGMA_IVDEP
+#define CHPL_PRAGMA_IVDEP _Pragma ("clang loop vectorize(assume_safety)")
 
 // PGI has supported "nodepchk" since at least version 6 (released 2005.) ivdep
 // is only supported for the fortran compiler, but nodepchk has identical
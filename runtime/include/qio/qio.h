@@ -638,6 +638,30 @@ void qio_file_get_style(qio_file_t* f, qio_style_t* style)
 // Calls fflush on a FILE* first.
 qioerr qio_file_length(qio_file_t* f, int64_t *len_out);
 
+// Map len bytes of a file starting at offset into memory, without
+// reading them. The mapping is private, so it can be written without
+// changing the file: a written page is copied on the first write.
+// On success, *data_out points to the data at offset and
+// *free_func_out is a void(*)(void*) that unmaps it when passed data.
+qioerr qio_file_mmap_region(qio_file_t* f, int64_t offset, int64_t len,
+                            qio_hint_t hints,
+                            void** data_out, void** free_func_out);
+
+// Open a staging file, which holds everything written to it in memory.
+qioerr qio_file_open_staging(qio_file_t** file_out, const qio_style_t* style);
+
+// Return the number of bytes held by a staging file.
+int64_t qio_file_staged_length(qio_file_t* staging);
+
+// Return the number of bytes passed on by a staging file so far.
+int64_t qio_file_staged_flushed(qio_file_t* staging);
+
+// Write the bytes held by a staging file to dst starting at offset with a
+// single pwrite, and empty the staging file. The staging file is emptied
+// even on error.
+qioerr qio_file_staged_pwrite(qio_file_t* staging, qio_file_t* dst,
+                              int64_t offset);
+
 /* CHANNELS ..... */
 
 /* A Read and Write Buffered channels support:
@@ -191,3 +191,331 @@ string_contains(c_string x, c_string y) {
 }
 
 
+
+
+//
+// Byte buffer search and hashing, used by the Chapel string type.
+//
+// These work on (pointer, length) pairs rather than on NUL-terminated
+// strings, since Chapel strings may contain NUL bytes and are searched
+// within a region.  Offsets are 0-based and -1 means "not found".
+//
+
+#define CHPL_BYTESET_WORD (8*sizeof(size_t))
+#define CHPL_BYTESET_SET(s, b) \
+  ((s)[(size_t)(b) / CHPL_BYTESET_WORD] |= \
+   (size_t)1 << ((size_t)(b) % CHPL_BYTESET_WORD))
+#define CHPL_BYTESET_HAS(s, b) \
+  ((s)[(size_t)(b) / CHPL_BYTESET_WORD] & \
+   (size_t)1 << ((size_t)(b) % CHPL_BYTESET_WORD))
+
+// Needles shorter than this, or haystacks shorter than
+// CHPL_TWOWAY_MIN_HAYSTACK, are searched with memchr and memcmp.  Setting
+// up the two-way tables is not worth it for those.
+#define CHPL_TWOWAY_MIN_NEEDLE 3
+#define CHPL_TWOWAY_MIN_HAYSTACK 256
+
+// Preprocessed needle for the two-way algorithm (Crochemore and Perrin),
+// extended with a bad-character shift on the last byte of the window.
+typedef struct {
+  const uint8_t* n;
+  size_t l;       // needle length
+  size_t ms;      // position before the critical factorization
+  size_t p;       // period, or the shift to use for non-periodic needles
+  size_t mem0;    // prefix known to match after shifting by a period
+  size_t byteset[256 / (8*sizeof(size_t))];
+  size_t shift[256];
+} chpl_twoway_t;
+
+static void chpl_twoway_init(chpl_twoway_t* tw,
+                             const uint8_t* n, size_t l) {
+  size_t i, ip, jp, k, p, ms, p0;
+
+  tw->n = n;
+  tw->l = l;
+  memset(tw->byteset, 0, sizeof(tw->byteset));
+  for (i = 0; i < l; i++) {
+    CHPL_BYTESET_SET(tw->byteset, n[i]);
+    tw->shift[n[i]] = i+1;
+  }
+
+  // Maximal suffix for the < ordering
+  ip = -1; jp = 0; k = p = 1;
+  while (jp+k < l) {
+    if (n[ip+k] == n[jp+k]) {
+      if (k == p) {
+        jp += p;
+        k = 1;
+      } else {
+        k++;
+      }
+    } else if (n[ip+k] > n[jp+k]) {
+      jp += k;
+      k = 1;
+      p = jp - ip;
+    } else {
+      ip = jp++;
+      k = p = 1;
+    }
+  }
+  ms = ip;
+  p0 = p;
+
+  // Maximal suffix for the > ordering
+  ip = -1; jp = 0; k = p = 1;
+  while (jp+k < l) {
+    if (n[ip+k] == n[jp+k]) {
+      if (k == p) {
+        jp += p;
+        k = 1;
+      } else {
+        k++;
+      }
+    } else if (n[ip+k] < n[jp+k]) {
+      jp += k;
+      k = 1;
+      p = jp - ip;
+    } else {
+      ip = jp++;
+      k = p = 1;
+    }
+  }
+  if (ip+1 > ms+1) ms = ip;
+  else p = p0;
+
+  if (memcmp(n, n+p, ms+1)) {
+    // Not periodic: any shift up to the longer half is safe.
+    tw->mem0 = 0;
+    tw->p = (ms > l-ms-1 ? ms : l-ms-1) + 1;
+  } else {
+    tw->mem0 = l-p;
+    tw->p = p;
+  }
+  tw->ms = ms;
+}
+
+static const uint8_t* chpl_twoway_search(const chpl_twoway_t* tw,
+                                         const uint8_t* h,
+                                         const uint8_t* z) {
+  const uint8_t* n = tw->n;
+  const size_t l = tw->l;
+  const size_t ms = tw->ms;
+  size_t k, mem = 0;
+
+  for (;;) {
+    if ((size_t)(z-h) < l) return NULL;
+
+    // Check the last byte of the window first
+    if (CHPL_BYTESET_HAS(tw->byteset, h[l-1])) {
+      k = l - tw->shift[h[l-1]];
+      if (k) {
+        if (k < mem) k = mem;
+        h += k;
+        mem = 0;
+        continue;
+      }
+    } else {
+      h += l;
+      mem = 0;
+      continue;
+    }
+
+    // Compare the right half, then the left half
+    for (k = (ms+1 > mem ? ms+1 : mem); k < l && n[k] == h[k]; k++);
+    if (k < l) {
+      h += k-ms;
+      mem = 0;
+      continue;
+    }
+    for (k = ms+1; k > mem && n[k-1] == h[k-1]; k--);
+    if (k <= mem) return h;
+    h += tw->p;
+    mem = tw->mem0;
+  }
+}
+
+static const uint8_t* chpl_bytes_find_short(const uint8_t* h, const uint8_t* z,
+                                            const uint8_t* n, size_t l) {
+  while ((size_t)(z-h) >= l) {
+    h = memchr(h, n[0], (z-h) - l + 1);
+    if (h == NULL) return NULL;
+    if (memcmp(h+1, n+1, l-1) == 0) return h;
+    h++;
+  }
+  return NULL;
+}
+
+int64_t chpl_bytes_find(const uint8_t* haystack, int64_t hlen,
+                        const uint8_t* needle, int64_t nlen) {
+  const uint8_t* z = haystack + hlen;
+  const uint8_t* h;
+  chpl_twoway_t tw;
+
+  if (nlen == 0) return 0;
+  if (nlen > hlen) return -1;
+  if (nlen == 1) {
+    h = memchr(haystack, needle[0], hlen);
+    return h ? h - haystack : -1;
+  }
+
+  // Skip to the first possible match before doing any setup
+  h = memchr(haystack, needle[0], hlen - nlen + 1);
+  if (h == NULL) return -1;
+
+  if (nlen < CHPL_TWOWAY_MIN_NEEDLE || z-h < CHPL_TWOWAY_MIN_HAYSTACK) {
+    h = chpl_bytes_find_short(h, z, needle, nlen);
+  } else {
+    chpl_twoway_init(&tw, needle, nlen);
+    h = chpl_twoway_search(&tw, h, z);
+  }
+  return h ? h - haystack : -1;
+}
+
+int64_t chpl_bytes_rfind(const uint8_t* haystack, int64_t hlen,
+                         const uint8_t* needle, int64_t nlen) {
+  size_t shift[256];
+  int64_t i, k;
+
+  if (nlen == 0) return hlen;
+  if (nlen > hlen) return -1;
+
+  // Sunday's variant of Horspool's algorithm run right to left: the
+  // shift is keyed on the byte just before the window, using the leftmost
+  // position of each byte in the needle.
+  for (i = 0; i < 256; i++)
+    shift[i] = nlen+1;
+  for (i = nlen-1; i >= 0; i--)
+    shift[needle[i]] = i+1;
+
+  i = hlen - nlen;
+  while (i >= 0) {
+    if (haystack[i] == needle[0]) {
+      for (k = nlen-1; k > 0 && haystack[i+k] == needle[k]; k--);
+      if (k == 0) return i;
+    }
+    if (i == 0) break;
+    i -= shift[haystack[i-1]] < (size_t)i ? shift[haystack[i-1]] : (size_t)i;
+  }
+  return -1;
+}
+
+int64_t chpl_bytes_count(const uint8_t* haystack, int64_t hlen,
+                         const uint8_t* needle, int64_t nlen) {
+  const uint8_t* z = haystack + hlen;
+  const uint8_t* h = haystack;
+  int64_t count = 0;
+  chpl_twoway_t tw;
+
+  if (nlen == 0) return hlen + 1;
+  if (nlen > hlen) return 0;
+
+  // Matches may overlap, so each search starts one byte after the
+  // previous match.
+  if (nlen < CHPL_TWOWAY_MIN_NEEDLE || hlen < CHPL_TWOWAY_MIN_HAYSTACK) {
+    while ((h = chpl_bytes_find_short(h, z, needle, nlen)) != NULL) {
+      count++;
+      h++;
+    }
+  } else {
+    chpl_twoway_init(&tw, needle, nlen);
+    while ((h = chpl_twoway_search(&tw, h, z)) != NULL) {
+      count++;
+      h++;
+    }
+  }
+  return count;
+}
+
+//
+// Hashing in the style of wyhash: the input is consumed 16 or 48 bytes at a
+// time, and each pair of 64-bit words is folded with a 64x64->128 bit
+// multiply.
+//
+static const uint64_t chpl_hash_secret[4] = {
+  0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+  0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+};
+
+static inline void chpl_hash_mum(uint64_t* a, uint64_t* b) {
+#ifdef __SIZEOF_INT128__
+  __uint128_t r = (__uint128_t)*a * *b;
+  *a = (uint64_t)r;
+  *b = (uint64_t)(r >> 64);
+#else
+  uint64_t ha = *a >> 32, hb = *b >> 32;
+  uint64_t la = (uint32_t)*a, lb = (uint32_t)*b;
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  uint64_t t = rl + (rm0 << 32);
+  uint64_t c = t < rl;
+  uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  *a = lo;
+  *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static inline uint64_t chpl_hash_mix(uint64_t a, uint64_t b) {
+  chpl_hash_mum(&a, &b);
+  return a ^ b;
+}
+
+static inline uint64_t chpl_hash_read8(const uint8_t* p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline uint64_t chpl_hash_read4(const uint8_t* p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint64_t chpl_bytes_hash(const uint8_t* p, int64_t len) {
+  const uint64_t* s = chpl_hash_secret;
+  uint64_t seed = chpl_hash_mix(s[0], s[1]);
+  uint64_t a, b;
+
+  if (len <= 16) {
+    if (len >= 4) {
+      a = (chpl_hash_read4(p) << 32) | chpl_hash_read4(p + ((len>>3)<<2));
+      b = (chpl_hash_read4(p+len-4) << 32) |
+          chpl_hash_read4(p + len - 4 - ((len>>3)<<2));
+    } else if (len > 0) {
+      a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len>>1] << 8) | p[len-1];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    int64_t i = len;
+    if (i > 48) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = chpl_hash_mix(chpl_hash_read8(p) ^ s[1],
+                             chpl_hash_read8(p+8) ^ seed);
+        see1 = chpl_hash_mix(chpl_hash_read8(p+16) ^ s[2],
+                             chpl_hash_read8(p+24) ^ see1);
+        see2 = chpl_hash_mix(chpl_hash_read8(p+32) ^ s[3],
+                             chpl_hash_read8(p+40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = chpl_hash_mix(chpl_hash_read8(p) ^ s[1],
+                           chpl_hash_read8(p+8) ^ seed);
+      p += 16;
+      i -= 16;
+    }
+    // The last 16 bytes, which may overlap with bytes already consumed
+    a = chpl_hash_read8(p+i-16);
+    b = chpl_hash_read8(p+i-8);
+  }
+
+  a ^= s[1];
+  b ^= seed;
+  chpl_hash_mum(&a, &b);
+  return chpl_hash_mix(a ^ s[0] ^ (uint64_t)len, b ^ s[1]);
+}
@@ -118,11 +118,3 @@ chpl_comm_wide_get_string(chpl_string* local, struct chpl_chpl____wide_chpl_stri
                       CHPL_COMM_UNKNOWN_ID, lineno, filename);
   *local = chpl_macro_tmp;
 }
-
-uint8_t* chpl__getInPlaceBufferData(chpl__inPlaceBuffer* buf) {
-  return buf->data;
-}
-
-uint8_t* chpl__getInPlaceBufferDataForWrite(chpl__inPlaceBuffer* buf) {
-  return chpl__getInPlaceBufferData(buf);
-}
@@ -1433,6 +1433,234 @@ qioerr qio_file_length(qio_file_t* f, int64_t *len_out)
   return err;
 }
 
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+// Regions mapped by qio_file_mmap_region are preceded by a private page
+// recording the address and length of the whole mapping, so that
+// qio_file_munmap_region only needs the data pointer.
+typedef struct qio_mmap_region_header_s {
+  void* base;
+  size_t len;
+} qio_mmap_region_header_t;
+
+static
+void qio_file_munmap_region(void* data)
+{
+  uintptr_t pagesize = sys_page_size();
+  uintptr_t page = ((uintptr_t) data) & ~(pagesize - 1);
+  qio_mmap_region_header_t* header;
+
+  if( ! data ) return;
+
+  header = (qio_mmap_region_header_t*) (page - pagesize);
+  sys_munmap(header->base, header->len);
+}
+
+qioerr qio_file_mmap_region(qio_file_t* f, int64_t offset, int64_t len,
+                            qio_hint_t hints,
+                            void** data_out, void** free_func_out)
+{
+  int64_t pagesize = sys_page_size();
+  int64_t skip = offset % pagesize;
+  int64_t file_len = 0;
+  size_t maplen;
+  void* base = NULL;
+  void* got = NULL;
+  qio_mmap_region_header_t* header;
+  qioerr err;
+
+  *data_out = NULL;
+  *free_func_out = NULL;
+
+  if( f->fd == -1 )
+    QIO_RETURN_CONSTANT_ERROR(ENOSYS, "mmap requires a file descriptor");
+  if( offset < 0 || len <= 0 )
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "invalid region to mmap");
+
+  err = qio_file_length(f, &file_len);
+  if( err ) return err;
+
+  // Pages past the end of the file can't be read.
+  if( len > file_len - offset )
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "mmap region extends past end of file");
+
+  // This check is (only) important for 32-bit systems.
+  if( len > SSIZE_MAX - skip - pagesize ) return QIO_ENOMEM;
+
+  maplen = skip + len;
+
+  // Reserve room for the header page and the file data together,
+  // then map the file over all but the first page.  The file mapping is
+  // private and writable so that writing to it copies the page rather
+  // than faulting; the file itself is never changed.
+  err = qio_int_to_err(sys_mmap(NULL, pagesize + maplen,
+                                PROT_READ|PROT_WRITE,
+                                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0, &base));
+  if( err ) return err;
+
+  err = qio_int_to_err(sys_mmap(qio_ptr_add(base, pagesize), maplen,
+                                PROT_READ|PROT_WRITE,
+                                MAP_PRIVATE|MAP_FIXED,
+                                f->fd, offset - skip, &got));
+  if( err ) {
+    sys_munmap(base, pagesize + maplen);
+    return err;
+  }
+
+  header = (qio_mmap_region_header_t*) base;
+  header->base = base;
+  header->len = pagesize + maplen;
+
+  err = qio_madvise_for_hints(got, maplen, hints);
+  if( err ) {
+    sys_munmap(base, pagesize + maplen);
+    return err;
+  }
+
+  *data_out = qio_ptr_add(got, skip);
+  *free_func_out = (void*) qio_file_munmap_region;
+  return 0;
+}
+
+// A staging file keeps the data written to it in one contiguous block
+// of memory until qio_file_staged_pwrite passes it on.  Writes are always
+// appended; the offset given to pwritev is ignored.
+typedef struct qio_staging_s {
+  char* data;
+  size_t len;
+  size_t cap;
+  int64_t flushed; // bytes passed on so far
+} qio_staging_t;
+
+static
+qioerr qio_staging_pwritev(void* fl, const struct iovec* iov, int iovcnt,
+                           off_t offset, ssize_t* num_written_out, void* fs)
+{
+  qio_staging_t* st = (qio_staging_t*) fl;
+  size_t total = 0;
+  int i;
+
+  for( i = 0; i < iovcnt; i++ ) total += iov[i].iov_len;
+
+  if( st->len + total > st->cap ) {
+    size_t cap = st->cap ? st->cap : 4096;
+    char* data;
+    while( cap < st->len + total ) cap *= 2;
+    data = (char*) qio_realloc(st->data, cap);
+    if( ! data ) {
+      *num_written_out = 0;
+      return QIO_ENOMEM;
+    }
+    st->data = data;
+    st->cap = cap;
+  }
+
+  for( i = 0; i < iovcnt; i++ ) {
+    qio_memcpy(st->data + st->len, iov[i].iov_base, iov[i].iov_len);
+    st->len += iov[i].iov_len;
+  }
+
+  *num_written_out = total;
+  return 0;
+}
+
+static
+qioerr qio_staging_close(void* fl, void* fs)
+{
+  qio_staging_t* st = (qio_staging_t*) fl;
+  qio_free(st->data);
+  qio_free(st);
+  return 0;
+}
+
+static
+qioerr qio_staging_length(void* fl, int64_t* len_out, void* fs)
+{
+  *len_out = ((qio_staging_t*) fl)->len;
+  return 0;
+}
+
+static const qio_file_functions_t qio_staging_functions = {
+  NULL,                 // writev
+  NULL,                 // readv
+  &qio_staging_pwritev, // pwritev
+  NULL,                 // preadv
+  &qio_staging_close,   // close
+  NULL,                 // open
+  NULL,                 // seek
+  &qio_staging_length,  // filelength
+  NULL,                 // getpath
+  NULL,                 // fsync
+  NULL,                 // getcwd
+  NULL,                 // get_fs_type
+  NULL,                 // get_chunk
+  NULL,                 // get_locales_for_region
+};
+
+qioerr qio_file_open_staging(qio_file_t** file_out, const qio_style_t* style)
+{
+  qio_staging_t* st;
+  qioerr err;
+
+  st = (qio_staging_t*) qio_calloc(sizeof(qio_staging_t), 1);
+  if( ! st ) return QIO_ENOMEM;
+
+  err = qio_file_init_usr(file_out, st, QIO_HINT_OWNED,
+                          QIO_FDFLAG_WRITEABLE | QIO_FDFLAG_SEEKABLE,
+                          style, NULL, &qio_staging_functions);
+  if( err ) qio_free(st);
+  return err;
+}
+
+int64_t qio_file_staged_length(qio_file_t* staging)
+{
+  return ((qio_staging_t*) staging->file_info)->len;
+}
+
+int64_t qio_file_staged_flushed(qio_file_t* staging)
+{
+  return ((qio_staging_t*) staging->file_info)->flushed;
+}
+
+qioerr qio_file_staged_pwrite(qio_file_t* staging, qio_file_t* dst,
+                              int64_t offset)
+{
+  qio_staging_t* st = (qio_staging_t*) staging->file_info;
+  size_t done = 0;
+  qioerr err = 0;
+
+  if( staging->fsfns != &qio_staging_functions )
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "not a staging file");
+
+  STARTING_SLOW_SYSCALL;
+  while( done < st->len && ! err ) {
+    ssize_t num_written = 0;
+    if( dst->fd != -1 ) {
+      err = qio_int_to_err(sys_pwrite(dst->fd, st->data + done,
+                                      st->len - done, offset + done,
+                                      &num_written));
+    } else if( dst->fsfns && dst->fsfns->pwritev ) {
+      struct iovec iov;
+      iov.iov_base = st->data + done;
+      iov.iov_len = st->len - done;
+      err = dst->fsfns->pwritev(dst->file_info, &iov, 1, offset + done,
+                                &num_written, dst->fs_info);
+    } else {
+      QIO_GET_CONSTANT_ERROR(err, ENOSYS, "file does not support pwrite");
+    }
+    if( ! err && num_written == 0 )
+      QIO_GET_CONSTANT_ERROR(err, EIO, "no progress in pwrite");
+    done += num_written;
+  }
+  DONE_SLOW_SYSCALL;
+
+  st->flushed += st->len;
+  st->len = 0;
+  return err;
+}
+
 /* CHANNELS ----------------------------- */
 static
 qioerr _qio_channel_init(qio_channel_t* ch, qio_chtype_t type)
@@ -3002,6 +3230,8 @@ int _use_buffered(qio_channel_t* ch, ssize_t len)
   else if (ch->cached_cur) return 1;
   else if (ch->mark_cur > 0) return 1;
   else if (method == QIO_METHOD_MEMORY) return 1;
+  // Files provided by a plugin have no fd for unbuffered I/O.
+  else if (ch->file->fsfns) return 1;
   // Do not bother initializing the buffer if we are going
   // to read outside of the channel's region.
   else if (offset == ch->end_pos) return 0; 
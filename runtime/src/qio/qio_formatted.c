@@ -2098,6 +2098,256 @@ error:
 }
 
 
+// Fast path for reading decimal numbers.
+//
+// Most numbers in a text file are ASCII decimal numbers and are
+// entirely contained in the channel's cached buffer.  Such a number
+// is parsed directly from that buffer instead of going through
+// _peek_number_unlocked, which reads it a character at a time and
+// then reads it again to convert it.
+//
+// The fast path only accepts a number when it is sure that the slow
+// path would read the same number.  Otherwise (e.g. if the number
+// might continue past the cached buffer, or uses a base prefix, or is
+// inf or nan), it reports that the slow path should be used.
+
+typedef struct fast_number_s {
+  signed char sign;      // -1 for a negative number, 1 otherwise
+  uint64_t mantissa;     // significant digits as an integer
+  int ndigits;           // number of significant digits in mantissa
+  int64_t exponent;      // power of 10 to multiply mantissa by
+  const char* start;     // the first character of the number
+  const char* end;       // just after the last character of the number
+} fast_number_t;
+
+// More than this many significant digits might not fit in a uint64_t
+#define FAST_NUMBER_MAX_DIGITS 19
+
+static inline
+int _fast_is_digit(char c)
+{
+  return '0' <= c && c <= '9';
+}
+
+// Returns true if the 8 bytes in v are all ASCII digits.
+static inline
+int _fast_is_eight_digits(uint64_t v)
+{
+  return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Converts 8 ASCII digits to their value. v must have been loaded in
+// little-endian order, so that the first digit is in the lowest byte.
+static inline
+uint32_t _fast_parse_eight_digits(uint64_t v)
+{
+  const uint64_t mask = 0x000000FF000000FFULL;
+  const uint64_t mul1 = 0x000F424000000064ULL; // 100 + (1000000 << 32)
+  const uint64_t mul2 = 0x0000271000000001ULL; // 1 + (10000 << 32)
+
+  v -= 0x3030303030303030ULL;
+  v = (v * 10) + (v >> 8);
+  v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+  return (uint32_t) v;
+}
+
+// Reads decimal digits starting at *p_inout and stopping before end,
+// adding them to n->mantissa. Returns the number of digits read
+// including any digits that were dropped because there were already
+// too many significant digits (those are counted in *dropped).
+static inline
+int64_t _fast_scan_digits(const char** p_inout, const char* end,
+                          fast_number_t* n, int64_t* dropped)
+{
+  const char* p = *p_inout;
+  const char* start = p;
+
+  // Skip leading zeros, which aren't significant.
+  if( n->ndigits == 0 ) {
+    while( p < end && *p == '0' ) p++;
+  }
+
+  while( end - p >= 8 && n->ndigits + 8 <= FAST_NUMBER_MAX_DIGITS ) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    v = le64toh(v);
+    if( ! _fast_is_eight_digits(v) ) break;
+    n->mantissa = n->mantissa * 100000000 + _fast_parse_eight_digits(v);
+    n->ndigits += 8;
+    p += 8;
+  }
+
+  while( p < end && _fast_is_digit(*p) ) {
+    if( n->ndigits < FAST_NUMBER_MAX_DIGITS ) {
+      n->mantissa = n->mantissa * 10 + (*p - '0');
+      n->ndigits++;
+    } else {
+      (*dropped)++;
+    }
+    p++;
+  }
+
+  *p_inout = p;
+  return p - start;
+}
+
+// Tries to read a decimal number from the channel's cached buffer.
+// Returns 1 and fills in *n if it could, or 0 if the slow path
+// should be used. Does not move the channel.
+static
+int _fast_peek_decimal(qio_channel_t* restrict ch,
+                       const qio_style_t* restrict style,
+                       int allow_neg_sign, int allow_real,
+                       fast_number_t* restrict n)
+{
+  const char* p = (const char*) ch->cached_cur;
+  const char* end = (const char*) ch->cached_end;
+  int64_t int_digits;
+  int64_t frac_digits = 0;
+  int64_t dropped = 0;
+
+  if( p == NULL || (style->base != 0 && style->base != 10) )
+    return 0;
+
+  n->sign = 1;
+  n->mantissa = 0;
+  n->ndigits = 0;
+  n->exponent = 0;
+
+  // Skip whitespace. Anything other than ASCII goes to the slow path,
+  // since it might be a multibyte whitespace character.
+  while( p < end && (*p == ' ' || *p == '\n' || *p == '\t' ||
+                     *p == '\r' || *p == '\v' || *p == '\f') )
+    p++;
+  if( p == end ) return 0;
+
+  n->start = p;
+
+  if( tolower(*p) == tolower(style->positive_char) ) {
+    p++;
+  } else if( allow_neg_sign &&
+             tolower(*p) == tolower(style->negative_char) ) {
+    n->sign = -1;
+    p++;
+  }
+  if( p == end ) return 0;
+
+  // 0x 0o 0b prefixes are handled by the slow path.
+  if( style->prefix_base && *p == '0' && end - p >= 2 ) {
+    char b = tolower(p[1]);
+    if( b == 'x' || b == 'o' || b == 'b' ) return 0;
+  }
+
+  int_digits = _fast_scan_digits(&p, end, n, &dropped);
+  if( p == end ) return 0;
+
+  // Integer digits that didn't fit in the mantissa scale it up.
+  n->exponent = dropped;
+
+  if( allow_real ) {
+    if( tolower(*p) == tolower(style->point_char) ) {
+      p++;
+      dropped = 0;
+      frac_digits = _fast_scan_digits(&p, end, n, &dropped);
+      // Fraction digits that fit in the mantissa scale it down.
+      n->exponent -= frac_digits - dropped;
+      if( p == end ) return 0;
+    }
+
+    if( int_digits + frac_digits == 0 ) return 0;
+
+    if( tolower(*p) == tolower(style->exponent_char) ) {
+      int exp_sign = 1;
+      int64_t exp = 0;
+      const char* exp_digits;
+
+      p++;
+      if( p < end && tolower(*p) == tolower(style->positive_char) ) {
+        p++;
+      } else if( p < end && tolower(*p) == tolower(style->negative_char) ) {
+        exp_sign = -1;
+        p++;
+      }
+      exp_digits = p;
+      while( p < end && _fast_is_digit(*p) && p - exp_digits < 6 ) {
+        exp = exp * 10 + (*p - '0');
+        p++;
+      }
+      // No exponent digits, or too many of them.
+      if( p == exp_digits || p == end || _fast_is_digit(*p) ) return 0;
+      n->exponent += exp_sign * exp;
+    }
+  } else {
+    if( int_digits == 0 || dropped > 0 ) return 0;
+  }
+
+  // The number must end inside the cached buffer with an ASCII
+  // character; the slow path decodes other characters and might
+  // report an error for them.
+  if( p == end || (unsigned char) *p >= 0x80 ) return 0;
+
+  n->end = p;
+  return 1;
+}
+
+// Powers of 10 that are exactly representable as a double.
+static const double _fast_exact_powers_of_10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Converts a number read by _fast_peek_decimal to a double.
+// Returns 1 on success or 0 if the slow path should be used.
+static
+int _fast_decimal_to_double(const qio_style_t* restrict style,
+                            const fast_number_t* restrict n,
+                            double* restrict out)
+{
+  double d;
+
+  if( n->mantissa == 0 ) {
+    *out = n->sign < 0 ? -0.0 : 0.0;
+    return 1;
+  }
+
+  // If the mantissa and the power of 10 are both exact doubles,
+  // a single multiplication or division is correctly rounded.
+  if( n->mantissa <= (1ULL << 53) &&
+      -22 <= n->exponent && n->exponent <= 22 ) {
+    d = (double) n->mantissa;
+    if( n->exponent < 0 ) d /= _fast_exact_powers_of_10[-n->exponent];
+    else d *= _fast_exact_powers_of_10[n->exponent];
+    *out = n->sign < 0 ? -d : d;
+    return 1;
+  }
+
+  // Otherwise, let strtod do it, provided it will understand the text
+  // and it is not too long.
+  if( style->point_char == '.' && tolower(style->exponent_char) == 'e' &&
+      style->positive_char == '+' && style->negative_char == '-' &&
+      n->end - n->start < 64 ) {
+    char buf[64];
+    char* end_conv;
+    ssize_t len = n->end - n->start;
+
+    memcpy(buf, n->start, len);
+    buf[len] = '\0';
+
+    errno = 0;
+    d = strtod(buf, &end_conv);
+    if( end_conv != buf + len ) return 0;
+    if( (d == HUGE_VAL || d == -HUGE_VAL || d == 0.0) && errno == ERANGE )
+      return 0;
+    *out = d;
+    return 1;
+  }
+
+  return 0;
+}
+
+
 qioerr qio_channel_scan_int(const int threadsafe, qio_channel_t* restrict ch, void* restrict out, size_t len, int issigned)
 {
   unsigned long long int num = 0;
@@ -2136,6 +2386,17 @@ qioerr qio_channel_scan_int(const int threadsafe, qio_channel_t* restrict ch, vo
   st.positive_char = tolower(style->positive_char);
   st.negative_char = tolower(style->negative_char);
 
+  if( ! st.allow_point ) {
+    fast_number_t fast;
+    if( _fast_peek_decimal(ch, style, issigned, false, &fast) ) {
+      num = fast.mantissa;
+      if( issigned ) sign = fast.sign;
+      ch->cached_cur = (void*) fast.end;
+      err = 0;
+      goto error;
+    }
+  }
+
   err = _peek_number_unlocked(ch, &st, &amount);
   if( qio_err_to_int(err) == EEOF && st.end > 0 ) err = 0; // we tolerate EOF if there's data.
   if( err ) goto error;
@@ -2298,6 +2559,16 @@ qioerr qio_channel_scan_float_or_imag(const int threadsafe, qio_channel_t* restr
   st.allow_i_after = needs_i;
   st.i_char = style->i_char;
 
+  if( ! needs_i ) {
+    fast_number_t fast;
+    if( _fast_peek_decimal(ch, style, true, true, &fast) &&
+        _fast_decimal_to_double(style, &fast, &num) ) {
+      ch->cached_cur = (void*) fast.end;
+      err = 0;
+      goto error;
+    }
+  }
+
   err = _peek_number_unlocked(ch, &st, &amount);
   if( qio_err_to_int(err) == EEOF && st.end > 0 ) err = 0; // we tolerate EOF if there's data.
   if( err ) goto error;
@@ -2464,6 +2735,34 @@ static inline int _ltoa_convert(char *tmp, int tmplen, uint64_t num, int base, i
   return at;
 }
 
+static const char _ltoa_decimal_pairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+// Like _ltoa_convert for base 10, but produces two digits per division.
+static inline int _ltoa_convert_decimal(char *tmp, int tmplen, uint64_t num)
+{
+  int at = tmplen-1;
+  int pair;
+
+  tmp[at] = '\0';
+  while( num >= 100 ) {
+    pair = (int) (num % 100) * 2;
+    num /= 100;
+    tmp[--at] = _ltoa_decimal_pairs[pair+1];
+    tmp[--at] = _ltoa_decimal_pairs[pair];
+  }
+  if( num >= 10 ) {
+    pair = (int) num * 2;
+    tmp[--at] = _ltoa_decimal_pairs[pair+1];
+    tmp[--at] = _ltoa_decimal_pairs[pair];
+  } else {
+    tmp[--at] = '0' + (int) num;
+  }
+  return at;
+}
+
 // dst must have room (at most 65 bytes for binary + '\0')
 // Returns the number of characters written (not including '\0')
 // or >= size if there wasn't room in the buffer (returns amt needed)
@@ -2489,7 +2788,7 @@ int _ltoa(char* restrict dst, size_t size, uint64_t num, int isnegative,
   else if( base == 8 )
     tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 8, 0);
   else if( base == 10 )
-    tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 10, 0);
+    tmp_skip = _ltoa_convert_decimal(tmp, sizeof(tmp), num);
   else if( base == 16 )
     tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 16, style->uppercase);
   else
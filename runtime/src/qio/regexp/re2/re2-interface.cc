@@ -408,6 +408,153 @@ void qio_regexp_channel_discard(qio_channel_s* ch, int64_t cur, int64_t min)
   assert( qio_channel_offset_unlocked(ch) == off );
 }
 
+// Before falling back to the byte-at-a-time search in RE2::MatchFile,
+// an unanchored search first runs RE2 directly over the data buffered
+// in the channel, one window of up to QIO_REGEXP_BULK_WINDOW bytes at a
+// time.  A window is a single qbuffer part when that part is large
+// enough; otherwise the window's bytes are copied into a scratch buffer.
+#define QIO_REGEXP_BULK_WINDOW (1024*1024)
+#define QIO_REGEXP_BULK_MIN_PART (4*1024)
+
+enum {
+  BULK_SEARCH_NO_MATCH,
+  BULK_SEARCH_FOUND,
+  BULK_SEARCH_GIVE_UP
+};
+
+// Advance the channel by 'amt' bytes.  If 'move_mark' is set, also move
+// the channel mark forward so that the searched data can be discarded.
+static
+void bulk_search_advance(qio_channel_s* ch, int64_t amt, bool move_mark)
+{
+  int64_t target = qio_channel_offset_unlocked(ch) + amt;
+
+  qio_channel_end_peek_buffer(false, ch, amt);
+
+  if( move_mark ) qio_regexp_channel_discard(ch, target, target);
+}
+
+// Search for the start of a match in ch[offset..end).
+//
+// When this returns BULK_SEARCH_FOUND, the channel is positioned at the
+// start of the leftmost match found.  When it returns
+// BULK_SEARCH_NO_MATCH, the channel is positioned at the end of the data
+// and there is no match.  When it returns BULK_SEARCH_GIVE_UP, no match
+// starts before the current channel position, but the remaining data has
+// to be searched by MatchFile.  In all cases *prev_byte is updated to be
+// the byte just before the channel position.
+//
+// Consecutive windows overlap by the regular expression's maximum match
+// length, and matches are only accepted if they could not have been
+// affected by the end of the window: a match that starts earlier than
+// the one found could still run past the end of the window.  For a
+// regular expression without a maximum match length, that can only be
+// ruled out when the window reaches the end of the data, so otherwise
+// the search is left to MatchFile.  Each window after the first one
+// also starts one byte early so that RE2 can see the preceding byte for
+// assertions like \b and ^.
+static
+qioerr bulk_search(RE2* re, qio_channel_s* ch, int64_t end, bool move_mark,
+                   int* result_out, int32_t* prev_byte)
+{
+  int64_t max_len = re->max_match_length_bytes();
+  int64_t ctx = 0;
+  std::string scratch;
+  qioerr err = 0;
+
+  while( true ) {
+    int64_t offset = qio_channel_offset_unlocked(ch);
+    int64_t want = end - offset;
+    bool at_eof = false;
+    bool covers_end;
+    qbuffer_t* buf = NULL;
+    qbuffer_iter_t start, stop;
+    qbytes_t* bytes = NULL;
+    int64_t skip = 0;
+    int64_t len = 0;
+    int64_t avail;
+    int64_t advance = 0;
+    int result = BULK_SEARCH_GIVE_UP;
+    StringPiece window;
+    StringPiece vec[1];
+
+    if( want <= ctx ) break;
+    if( want > QIO_REGEXP_BULK_WINDOW ) want = QIO_REGEXP_BULK_WINDOW;
+
+    err = qio_channel_require_read(false, ch, want);
+    if( qio_err_to_int(err) == EEOF ) {
+      err = 0;
+      at_eof = true;
+    }
+    if( err ) break;
+
+    err = qio_channel_begin_peek_buffer(false, ch, 0, false,
+                                        &buf, &start, &stop);
+    if( err ) break;
+
+    avail = qbuffer_iter_num_bytes(start, stop);
+    if( avail > want ) avail = want;
+    if( avail <= ctx ) {
+      qio_channel_end_peek_buffer(false, ch, 0);
+      break;
+    }
+
+    qbuffer_iter_get(start, stop, &bytes, &skip, &len);
+    if( len >= avail || len >= QIO_REGEXP_BULK_MIN_PART ) {
+      if( len > avail ) len = avail;
+      window.set((const char*) qbytes_data(bytes) + skip, len);
+    } else {
+      qbuffer_iter_t wend = start;
+
+      qbuffer_iter_advance(buf, &wend, avail);
+      scratch.resize(avail);
+      err = qbuffer_copyout(buf, start, wend, &scratch[0], avail);
+      if( err ) {
+        qio_channel_end_peek_buffer(false, ch, 0);
+        break;
+      }
+      window.set(scratch.data(), avail);
+    }
+
+    covers_end = (int64_t) window.size() == avail &&
+                 (at_eof || offset + avail == end);
+
+    if( re->Match(window, ctx, window.size(), RE2::UNANCHORED, vec, 1) ) {
+      int64_t found = vec[0].data() - window.data();
+
+      if( covers_end ||
+          (max_len >= 0 && found + max_len < (int64_t) window.size()) ) {
+        result = BULK_SEARCH_FOUND;
+        advance = found;
+      }
+    } else if( covers_end ) {
+      result = BULK_SEARCH_NO_MATCH;
+      advance = window.size();
+    }
+
+    if( result == BULK_SEARCH_GIVE_UP && max_len >= 0 ) {
+      // Keep the last max_len+1 bytes for the next window.
+      advance = window.size() - max_len - 1;
+      if( advance < 0 ) advance = 0;
+    }
+
+    if( advance > 0 ) *prev_byte = (unsigned char) window[advance-1];
+
+    bulk_search_advance(ch, advance, move_mark);
+
+    if( result != BULK_SEARCH_GIVE_UP ) {
+      *result_out = result;
+      return 0;
+    }
+
+    if( advance == 0 ) break;
+
+    ctx = 1;
+  }
+
+  *result_out = BULK_SEARCH_GIVE_UP;
+  return err;
+}
 
 qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe, struct qio_channel_s* ch, int64_t maxlen, int anchor, qio_bool can_discard, qio_bool keep_unmatched, qio_bool keep_whole_pattern, qio_regexp_string_piece_t* captures, int64_t ncaptures)
 {
@@ -421,6 +568,9 @@ qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe
   int64_t end;
   int64_t match_start = -1;
   int64_t match_len = 0;
+  int64_t search_offset;
+  int32_t prev_byte = 0;
+  int bulk = BULK_SEARCH_GIVE_UP;
   StringPiece buffer;
   FilePiece text;
   FilePiece* locs;
@@ -475,6 +625,25 @@ qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe
     goto markerror;
   }
 
+  if( ranchor == RE2::UNANCHORED && ! re->anchored_start() &&
+      FilePiece::allow_buffer_search() ) {
+    err = bulk_search(re, ch, end, can_discard && ! keep_unmatched,
+                      &bulk, &prev_byte);
+    if( err ) goto error;
+    if( bulk == BULK_SEARCH_NO_MATCH ) {
+      for( i = 0; i < ncaptures; i++ ) {
+        captures[i].offset = -1;
+        captures[i].len = 0;
+      }
+      goto error;
+    }
+  }
+
+  // Continue the search from wherever bulk_search left off.
+  search_offset = qio_channel_offset_unlocked(ch);
+  ci.offset = search_offset-1;
+  ci.byte = prev_byte;
+
   // Require at least 1 byte and at most 1024 bytes.
   need = re->min_match_length_bytes();
   if( need <= 0 ) need = 1;
@@ -490,14 +659,18 @@ qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe
 
   // We never call end_peek_cached. (should be OK since we do unlock)
  
-  if( qio_ptr_diff(bufend, bufstart) > maxlen ) {
-    bufend = qio_ptr_add(bufstart, maxlen);
+  if( qio_ptr_diff(bufend, bufstart) > end - search_offset ) {
+    bufend = qio_ptr_add(bufstart, end - search_offset);
   }
 
   // Construct the StringPiece for the buffer.
   buffer.set((const char*) bufstart, qio_ptr_diff(bufend, bufstart));
+
+  // If bulk_search found where the match starts, MatchFile only needs
+  // to find where it ends.
+  if( bulk == BULK_SEARCH_FOUND ) ranchor = RE2::ANCHOR_START;
   // and the qio_channel_string_piece
-  text.set_channel_info(&ci, start_offset, end);
+  text.set_channel_info(&ci, search_offset, end);
 
   if( ncaptures == 0 ) use_captures = 1;
   MAYBE_STACK_ALLOC(FilePiece, use_captures, locs, caps_onstack);
@@ -0,0 +1,125 @@
+use StencilDist;
+
+config const debug = false;
+
+// A value that depends on the position of 'idx' in the periodic space
+proc value(dom, idx) {
+  const ix = if isTuple(idx) then idx else (idx,);
+  var val = 0;
+  for param i in 1..dom.rank {
+    const r = dom.dim(i);
+    const span = r.size * abs(r.stride);
+    var x = ix(i);
+    if x < r.low then x += span;
+    if x > r.high then x -= span;
+    val = val * 1000 + x;
+  }
+  return val;
+}
+
+//
+// Check every cached element directly in each locale's local array. This
+// uses two target locales per dimension, repeating locales if necessary,
+// so that the packed buffers are used even when running on one locale.
+//
+proc testExchange(dom : domain, halo : dom.rank * int) {
+  param rank = dom.rank;
+
+  var dims : rank*range;
+  for i in 1..rank do dims(i) = 1..2;
+  var T : [{(...dims)}] locale;
+  for (t, i) in zip(T, 0..) do t = Locales[i % numLocales];
+
+  var Space = dom dmapped Stencil(dom, targetLocales=T, fluff=halo,
+                                  periodic=true);
+  var A : [Space] int;
+
+  proc check(round) {
+    const arr = A._value;
+    for i in arr.dom.dist.targetLocDom {
+      const LA = arr.locArr[i];
+      on LA {
+        forall idx in LA.locDom.myBlock do LA.myElems[idx] = round + value(Space, idx);
+      }
+    }
+
+    A.startFluffUpdate();
+    A.finishFluffUpdate();
+
+    for i in arr.dom.dist.targetLocDom {
+      const LA = arr.locArr[i];
+      on LA {
+        for idx in LA.locDom.myFluff {
+          if LA.myElems[idx] != round + value(Space, idx) {
+            writeln("Failed: ", dom, " with halo ", halo, " at ", idx);
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  check(0);
+  check(1);
+
+  // The buffers move when the domain changes
+  Space = dom.expand(halo);
+  check(2);
+}
+
+//
+// Compute the interior while the halos are in flight, then the boundary,
+// and compare against a computation after updateFluff.
+//
+proc testKernel(dom : domain, halo : dom.rank * int) {
+  param rank = dom.rank;
+
+  var Space = dom dmapped Stencil(dom, fluff=halo, periodic=true);
+  var A, B, C : [Space] int;
+
+  forall idx in Space do A[idx] = value(dom, idx);
+
+  proc kernel(i) {
+    const idx = if isTuple(i) then i else (i,);
+    var val = 0;
+    for d in 1..rank {
+      var off : rank*int;
+      off(d) = halo(d) * abs(dom.dim(d).stride);
+      val += A[idx+off] - A[idx-off];
+    }
+    return val;
+  }
+
+  A.startFluffUpdate();
+  forall idx in Space.interiorIndices() do B[idx] = kernel(idx);
+  A.finishFluffUpdate();
+  forall idx in Space.boundaryIndices() do B[idx] = kernel(idx);
+
+  A.updateFluff();
+  forall idx in Space do C[idx] = kernel(idx);
+
+  if || reduce (B != C) then
+    writeln("Failed: kernel over ", dom, " with halo ", halo);
+
+  // Each index is yielded by exactly one of the iterators
+  var count : [Space] int;
+  for idx in Space.interiorIndices() do count[idx] += 1;
+  for idx in Space.boundaryIndices() do count[idx] += 1;
+  if || reduce (count != 1) then
+    writeln("Failed: interior and boundary of ", dom, " with halo ", halo);
+}
+
+proc test(dom : domain, halo : dom.rank * int) {
+  if debug then writeln("Testing domain ", dom, " with halo ", halo);
+  testExchange(dom, halo);
+  testKernel(dom, halo);
+}
+
+test({1..10, 1..10}, (1, 1));
+test({1..10, 1..10}, (2, 2));
+test({1..10, 1..10}, (1, 0));
+test({-3..11}, (2,));
+test({1..8, 1..8, 1..8}, (1, 1, 1));
+test({-10..#30, -10..#30, -10..#30} by 3, (1, 1, 1));
+
+writeln("done");
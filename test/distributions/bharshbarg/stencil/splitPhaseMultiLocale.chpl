@@ -0,0 +1,58 @@
+use StencilDist;
+
+//
+// Run the packed split-phase fluff update across distinct locales. Every
+// round writes new values and then checks all cached elements, so a round
+// that copies a halo before its GET has completed sees the previous
+// round's values.
+//
+
+config const n = 200,
+             rounds = 20;
+
+proc value(dom, idx, round) {
+  var val = round;
+  for param i in 1..dom.rank {
+    const r = dom.dim(i);
+    var x = idx(i);
+    if x < r.low then x += r.size;
+    if x > r.high then x -= r.size;
+    val = val * 1000 + x;
+  }
+  return val;
+}
+
+const Dom = {1..n, 1..n};
+const Space = Dom dmapped Stencil(Dom, fluff=(2, 2), periodic=true);
+var A : [Space] int;
+
+if A._value.dom.dist.targetLocales.size == 1 then
+  writeln("Expected more than one target locale");
+
+var failed = false;
+for round in 1..rounds {
+  forall idx in Space do A[idx] = value(Dom, idx, round);
+
+  A.startFluffUpdate();
+  // Work on the interior while the GETs are in flight
+  var sum : int;
+  forall idx in Space.interiorIndices() with (+ reduce sum) do sum += A[idx];
+  A.finishFluffUpdate();
+
+  const arr = A._value;
+  for i in arr.dom.dist.targetLocDom {
+    const LA = arr.locArr[i];
+    on LA {
+      for idx in LA.locDom.myFluff {
+        if LA.myElems[idx] != value(Dom, idx, round) {
+          writeln("Failed: round ", round, " at ", idx, " on locale ", here.id);
+          failed = true;
+          break;
+        }
+      }
+    }
+  }
+  if failed then break;
+}
+
+writeln("done");
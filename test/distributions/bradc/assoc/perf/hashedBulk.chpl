@@ -0,0 +1,104 @@
+/*
+  Rates of inserting, looking up, reading and writing the indices of a
+  Hashed domain and array one key at a time and in bulk.
+*/
+
+use HashedDist;
+use Random;
+use Time;
+
+config const numKeys = 1000000,
+             /* Omit timing output */
+             correctness = false;
+
+proc main() {
+  if !correctness {
+    writeln('=====================================');
+    writeln('Hashed Bulk Operations Perf Test');
+    writeln('=====================================');
+    writeln('locales : ', numLocales);
+    writeln('keys    : ', numKeys);
+    writeln();
+  }
+
+  var keys: [0..#numKeys] int;
+  fillRandom(keys, seed=314159265);
+  var vals: [0..#numKeys] int = 0..#numKeys;
+
+  var t: Timer;
+
+  // Per-key operations
+  {
+    var D: domain(int) dmapped Hashed(idxType=int);
+    var A: [D] int;
+
+    t.start();
+    forall k in keys with (ref D) do D += k;
+    t.stop();
+    report('add', t.elapsed());
+
+    t.clear();
+    var nFound = 0;
+    t.start();
+    forall k in keys with (+ reduce nFound) do
+      if D.contains(k) then nFound += 1;
+    t.stop();
+    report('contains', t.elapsed());
+    check(nFound == numKeys, 'contains');
+
+    t.clear();
+    t.start();
+    forall (k, v) in zip(keys, vals) do A[k] = v;
+    t.stop();
+    report('set', t.elapsed());
+
+    var got: [0..#numKeys] int;
+    t.clear();
+    t.start();
+    forall (g, k) in zip(got, keys) do g = A[k];
+    t.stop();
+    report('get', t.elapsed());
+    check(&& reduce (got == [k in keys] A[k]), 'get');
+  }
+
+  // Bulk operations
+  {
+    var D: domain(int) dmapped Hashed(idxType=int);
+    var A: [D] int;
+
+    t.clear();
+    t.start();
+    D.bulkAdd(keys);
+    t.stop();
+    report('bulk add', t.elapsed());
+
+    t.clear();
+    t.start();
+    const found = D.bulkContains(keys);
+    t.stop();
+    report('bulk contains', t.elapsed());
+    check(&& reduce found, 'bulk contains');
+
+    t.clear();
+    t.start();
+    A.bulkSet(keys, vals);
+    t.stop();
+    report('bulk set', t.elapsed());
+
+    t.clear();
+    t.start();
+    const got = A.bulkGet(keys);
+    t.stop();
+    report('bulk get', t.elapsed());
+    check(&& reduce (got == [k in keys] A[k]), 'bulk get');
+  }
+}
+
+proc report(op, elapsed) {
+  if !correctness then
+    writeln(op, ' keys/sec: ', numKeys / elapsed);
+}
+
+proc check(ok, what) {
+  if !ok then writeln('Error: ', what, ' gave wrong results');
+}
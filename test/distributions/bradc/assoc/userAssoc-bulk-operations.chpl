@@ -0,0 +1,57 @@
+use HashedDist;
+
+config const n = 1000;
+
+proc test(targetLocales) {
+  var D: domain(int) dmapped Hashed(idxType=int, targetLocales=targetLocales);
+
+  // add with duplicates, both within the batch and with existing indices
+  D += 0;
+  const inds = [i in 0..#2*n] i % n;
+  writeln(D.bulkAdd(inds));
+  writeln(D.size);
+  writeln(D.bulkAdd([n, 0, n+1, n]));
+  writeln(D.size);
+
+  const found = D.bulkContains([-1, 0, n-1, n, n+1, n+2]);
+  writeln(found);
+  assert(&& reduce D.bulkContains(inds));
+
+  var A: [D] int;
+  const keys = [i in 0..#n] (7 * i) % n;
+  const newVals = [k in keys] 2 * k;
+  A.bulkSet(keys, newVals);
+  for k in keys do assert(A[k] == 2 * k);
+
+  const vals = A.bulkGet([n-1, 0, n+1, 1]);
+  writeln(vals);
+  assert(&& reduce (A.bulkGet(inds) == [i in inds] 2 * i));
+
+  // inds and vals pair up as zip() pairs them, even when their domains
+  // differ; compare against a default associative array
+  const someKeys: [1..3] int = [5, 1, 3];
+  const someVals: [0..2] int = [50, 10, 30];
+  const stridedKeys: [0..4 by -2] int = [2, 4, 6];
+  const stridedVals: [10..12] int = [20, 40, 60];
+
+  var LocalD: domain(int);
+  LocalD.bulkAdd(someKeys);
+  LocalD.bulkAdd(stridedKeys);
+  var LocalA: [LocalD] int;
+
+  A.bulkSet(someKeys, someVals);
+  LocalA.bulkSet(someKeys, someVals);
+  writeln(A.bulkGet(someKeys));
+  assert(&& reduce (A.bulkGet(someKeys) == LocalA.bulkGet(someKeys)));
+
+  A.bulkSet(stridedKeys, stridedVals);
+  LocalA.bulkSet(stridedKeys, stridedVals);
+  writeln(A.bulkGet(stridedKeys));
+  assert(&& reduce (A.bulkGet(stridedKeys) == LocalA.bulkGet(stridedKeys)));
+}
+
+// list this locale several times to exercise the routing
+const repeatedLocales: [0..#4] locale = Locales[0];
+
+test(Locales);
+test(repeatedLocales);
@@ -0,0 +1,68 @@
+use IO, BlockDist;
+
+config const n = 300000;
+config const filename = "binary-array-parallel.bin";
+
+// Write A serially and with writeBinaryArray, check that the files match,
+// and read the data back into B.
+proc check(name, A, ref B) {
+  var f = open(filename, iomode.cwr);
+  var w = f.writer(kind=ionative);
+  w.write(A);
+  w.close();
+  const expected = f.length();
+  var serialBytes: [0..#expected] uint(8);
+  f.reader(kind=ionative).read(serialBytes);
+
+  f.writeBinaryArray(A, start=expected);
+  var parallelBytes: [0..#expected] uint(8);
+  f.reader(kind=ionative, start=expected).read(parallelBytes);
+
+  B = 0:B.eltType;
+  f.readBinaryArray(B, start=expected);
+
+  writeln(name, ": ", f.length() == 2 * expected, " ",
+          && reduce (serialBytes == parallelBytes), " ", && reduce (A == B));
+  f.close();
+}
+
+{
+  var A, B: [1..n] int;
+  forall i in A.domain do A[i] = i * 7 - 3;
+  check("1D", A, B);
+}
+
+{
+  var A, B: [0..#100, -5..#n/100] real(32);
+  forall (i, j) in A.domain do A[i, j] = (i + j / 1000.0):real(32);
+  check("2D", A, B);
+}
+
+{
+  const D = {1..n} dmapped Block({1..n});
+  var A, B: [D] uint(16);
+  forall i in D do A[i] = (i % 65536):uint(16);
+  check("Block 1D", A, B);
+}
+
+{
+  const D = {1..37, 1..n/37} dmapped Block({1..37, 1..n/37});
+  var A, B: [D] complex;
+  forall (i, j) in D do A[i, j] = (i + j * 1.0i): complex;
+  check("Block 2D", A, B);
+}
+
+// Other arrays use the serial format.
+{
+  var A, B: [1..n by 3] int;
+  forall i in A.domain do A[i] = -i;
+  check("strided", A, B);
+}
+
+{
+  var A, B: [1..1000] bool;
+  forall i in A.domain do A[i] = i % 3 == 0;
+  check("bool", A, B);
+}
+
+unlink(filename);
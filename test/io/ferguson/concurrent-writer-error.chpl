@@ -0,0 +1,35 @@
+use IO;
+
+// A TaskWriter that can not write its remaining data when it goes out of
+// scope keeps the error for ConcurrentWriter.check(), or reports it if
+// nobody checks.
+const filename = "concurrent-writer-error.txt";
+open(filename, iomode.cw).close();
+
+// The file is only open for reading, so writing to it fails
+var f = open(filename, iomode.r);
+{
+  var cw = f.concurrentWriter();
+  {
+    var w = cw.taskWriter();
+    w.writeln("hello");
+  }
+  try {
+    cw.check();
+    writeln("no error");
+  } catch e: SystemError {
+    writeln("caught SystemError");
+  } catch {
+    writeln("caught other error");
+  }
+}
+
+{
+  var cw = f.concurrentWriter();
+  {
+    var w = cw.taskWriter();
+    w.writeln("hello");
+  }
+}
+writeln("done");
+f.close();
@@ -0,0 +1,43 @@
+use IO;
+
+config const n = 20000;
+config const flushBytes = 1000;
+
+const filename = "concurrent-writer.txt";
+
+var f = open(filename, iomode.cw);
+var cw = f.concurrentWriter(flushBytes=flushBytes);
+
+forall i in 1..n with (var w = cw.taskWriter()) {
+  if i % 2 == 0 then
+    w.writeln(i, ",", i*i);
+  else
+    w.writef("%i,%i\n", i, i*i);
+}
+
+// Data written after the loop follows everything written in it.
+{
+  var w = cw.taskWriter();
+  w.write("end");
+  w.writeln();
+  w.flush();
+  writeln(cw.offset() == f.length());
+}
+f.close();
+
+var seen:[1..n] int;
+var wellFormed = true;
+var last = "";
+for line in open(filename, iomode.r).lines() {
+  last = line;
+  if line == "end\n" then continue;
+  const fields = line.strip().split(",");
+  const i = fields[1]:int;
+  if fields.size != 2 || i < 1 || i > n || fields[2]:int != i*i then
+    wellFormed = false;
+  else
+    seen[i] += 1;
+}
+writeln(wellFormed, " ", && reduce (seen == 1), " ", last == "end\n");
+
+unlink(filename);
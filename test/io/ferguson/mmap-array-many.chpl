@@ -0,0 +1,24 @@
+use IO;
+
+// Each mmapArray unmaps its region when it is destroyed, so creating many
+// of them one after another does not run out of mappings.
+config const numArrays = 100000;
+config const filename = "mmap-array-many.bin";
+
+{
+  var f = open(filename, iomode.cw);
+  var w = f.writer(kind=ionative);
+  for i in 0..#16 do w.write(i);
+  w.close();
+  f.close();
+}
+
+var f = open(filename, iomode.r);
+var sum = 0;
+for i in 0..#numArrays {
+  var A = f.mmapArray(int, start=(i % 16) * numBytes(int), numElements=1);
+  sum += A[0];
+}
+writeln(sum == (numArrays / 16) * (+ reduce (0..15)) +
+               (+ reduce (0..#numArrays % 16)));
+f.close();
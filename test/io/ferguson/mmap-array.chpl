@@ -0,0 +1,54 @@
+use IO;
+
+config const n = 100000;
+config const filename = "mmap-array.bin";
+
+{
+  var f = open(filename, iomode.cw);
+  var w = f.writer(kind=ionative);
+  for i in 0..#n do w.write(i * 3);
+  w.write(1.5, 2.5);
+  w.close();
+  f.close();
+}
+
+var f = open(filename, iomode.r);
+
+// The whole file as ints; the two reals at the end are included too.
+{
+  var A = f.mmapArray(int, hints=IOHINT_SEQUENTIAL);
+  var numWrong = 0;
+  for i in 0..#n do
+    if A[i] != i * 3 then numWrong += 1;
+  writeln(A.domain, " ", numWrong);
+}
+
+// Part of the file.
+{
+  const start = (n - 2) * numBytes(int);
+  var R = f.mmapArray(real, start=start + 2*numBytes(int));
+  writeln(R);
+  var A = f.mmapArray(int, start=start, numElements=2, hints=IOHINT_RANDOM);
+  writeln(A);
+}
+
+// The arrays can be changed without changing the file, even though the
+// file is only open for reading.
+{
+  var A = f.mmapArray(int);
+  forall a in A[0..#n] do a += 1;
+  var B = f.mmapArray(int, numElements=n);
+  writeln(+ reduce (A[0..#n] - B));
+}
+
+// A region past the end of the file is an error.
+try {
+  var A = f.mmapArray(int, numElements=n + 3);
+} catch e: SystemError {
+  writeln("error: ", e.err == EINVAL);
+} catch {
+  writeln("unexpected error");
+}
+
+f.close();
+unlink(filename);
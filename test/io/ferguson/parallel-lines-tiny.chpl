@@ -0,0 +1,31 @@
+use IO;
+
+// Files with fewer bytes than there are locales or tasks to split them
+// between, including an empty file, are read in parallel like any other.
+config const fname = "parallel-lines-tiny.txt";
+
+for contents in ["", "a", "\n", "a\n", "a\nb", "ab\n\ncd\n"] {
+  {
+    var f = open(fname, iomode.cw);
+    var w = f.writer();
+    w.write(contents);
+    w.close();
+    f.close();
+  }
+
+  var f = open(fname, iomode.r);
+  var serialCount, serialLengths: int;
+  for line in f.lines() {
+    serialCount += 1;
+    serialLengths += line.length;
+  }
+
+  var count, lengths: int;
+  forall line in f.lines() with (+ reduce count, + reduce lengths) {
+    count += 1;
+    lengths += line.length;
+  }
+  writeln(contents.length, ": ", count, " ", count == serialCount,
+          " ", lengths == serialLengths);
+  f.close();
+}
@@ -0,0 +1,7 @@
+use IO;
+
+// file.lines() has no leader or follower, since its parallel iterator
+// yields lines in no particular order
+var f = openmem();
+forall (line, i) in zip(f.lines(), 1..) do
+  writeln(i, ": ", line);
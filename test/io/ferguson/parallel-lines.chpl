@@ -0,0 +1,40 @@
+use IO;
+
+config const n = 1000;
+config const fname = "parallel-lines.txt";
+
+{
+  var f = open(fname, iomode.cw);
+  var w = f.writer();
+  for i in 1..n do w.writeln(i, " ", "x"*(i%37));
+  // no newline after the last line
+  w.write(n+1);
+  w.close();
+  f.close();
+}
+
+var f = open(fname, iomode.r);
+
+proc check(start:int, end:int) {
+  var serialCount, serialLengths: int;
+  for line in f.lines(start=start, end=end) {
+    serialCount += 1;
+    serialLengths += line.length;
+  }
+
+  var count, lengths: int;
+  forall line in f.lines(start=start, end=end) with (+ reduce count,
+                                                    + reduce lengths) {
+    count += 1;
+    lengths += line.length;
+  }
+
+  writeln(start, "..", end, ": ", count == serialCount,
+          " ", lengths == serialLengths);
+}
+
+check(0, max(int));
+check(7, 2000);
+check(1000, 1001);
+
+f.close();
@@ -0,0 +1,95 @@
+use IO;
+
+config const n = 100000;
+
+var f = openmem();
+
+// Integers of various lengths with signs and leading zeros.
+{
+  var w = f.writer();
+  for i in 1..n {
+    const x = (i * 7919) % 1000003 - 500000;
+    if i % 7 == 0 && x >= 0 then w.write("+");
+    if i % 11 == 0 && x >= 0 then w.write("00");
+    w.write(x);
+    w.write(if i % 10 == 0 then "\n" else " ");
+  }
+  w.close();
+}
+
+{
+  var A: [1..n] int;
+  var numRead: int;
+  var r = f.reader();
+  const ok = r.readArray(A, numRead);
+  var numWrong = 0;
+  for i in 1..n do
+    if A[i] != (i * 7919) % 1000003 - 500000 then numWrong += 1;
+  writeln("ints: ", ok, " ", numRead == n, " ", numWrong);
+
+  // At EOF, nothing more can be read.
+  writeln("ints at EOF: ", r.readArray(A, numRead), " ", numRead);
+  r.close();
+}
+
+// Reading into part of an array stops at EOF.
+{
+  var B: [0..n+9] int(32);
+  var numRead: int;
+  var r = f.reader();
+  const ok = r.readArray(B, numRead, start=5);
+  writeln("partial: ", ok, " ", numRead == n, " ", B[4], " ",
+          B[5] == -492081, " ", B[n+5]);
+  r.close();
+}
+
+// Reals in several formats. Those written with 17 digits read back exactly.
+{
+  var w = f.writer();
+  for i in 1..n {
+    const x = (i - n/2) * 1.0e-7 * i + i;
+    select i % 4 {
+      when 0 do w.writef("%.17er ", x);
+      when 1 do w.writef("%.17dr ", x);
+      when 2 do w.writef("%.6er\n", 1.0e100 / i);
+      otherwise do w.writef("%r ", x);
+    }
+  }
+  w.write("-0.0 0 .5 5. 1e22 123456789012345678901234567890 ");
+  w.close();
+}
+
+{
+  var A: [1..n+6] real;
+  var numRead: int;
+  var r = f.reader();
+  const ok = r.readArray(A, numRead);
+  var numWrong = 0;
+  // The rounded values are checked against read() below.
+  for i in 1..n {
+    const x = (i - n/2) * 1.0e-7 * i + i;
+    if i % 4 <= 1 && A[i] != x then numWrong += 1;
+  }
+  writeln("reals: ", ok, " ", numRead == n+6, " ", numWrong);
+  writeln(A[n+1..]);
+  r.close();
+}
+
+// The same values read one at a time agree with readArray.
+{
+  var A: [1..n] real;
+  var numRead: int;
+  var r = f.reader();
+  r.readArray(A, numRead, amount=n);
+  r.close();
+
+  var numWrong = 0;
+  r = f.reader();
+  for i in 1..n {
+    var x: real;
+    r.read(x);
+    if x != A[i] then numWrong += 1;
+  }
+  writeln("one at a time: ", numWrong);
+  r.close();
+}
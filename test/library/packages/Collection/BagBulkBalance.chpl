@@ -0,0 +1,40 @@
+use DistributedBag;
+
+// Test the bulk operations of DistBag and its balancing: every element
+// added in bulk must be removed exactly once, whether or not it was moved
+// to another node in the meantime.
+config const nElems = 100000;
+
+var bag = new DistBag(int);
+
+// All elements are added from one node, so with several nodes this moves
+// some of them elsewhere. They are added in batches, and only the batches
+// that grow this node enough since the last check look for an imbalance.
+config const nBatches = 10;
+for batch in 0..#nBatches {
+  const lo = batch * nElems / nBatches + 1, hi = (batch+1) * nElems / nBatches;
+  assert(bag.addBulk(lo..hi) == hi - lo + 1);
+}
+assert(bag.getSize() == nElems);
+
+// Add some more from every node and then even everything out.
+coforall loc in Locales do on loc {
+  assert(bag.addBulk(nElems+1 + 10*here.id..#10) == 10);
+}
+const total = nElems + 10 * numLocales;
+bag.balance();
+assert(bag.getSize() == total);
+
+var seen : [1..total] atomic int;
+coforall loc in Locales do on loc {
+  var done = false;
+  while !done {
+    const elts = bag.removeBulk(1000);
+    for elt in elts do seen[elt].add(1);
+    done = elts.size == 0;
+  }
+}
+
+assert(bag.getSize() == 0);
+assert(&& reduce [s in seen] s.read() == 1);
+writeln("SUCCESS");
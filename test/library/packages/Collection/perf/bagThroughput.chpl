@@ -0,0 +1,96 @@
+/*
+  Throughput of DistBag insertions and removals, one element at a time and
+  in bulk, from every task on every locale.
+*/
+
+use DistributedBag;
+use Time;
+
+config const opsPerTask = 100000,
+             /* Elements per call for the bulk operations */
+             bulkSize = 1000,
+             /* Tasks per locale; 0 means here.maxTaskPar */
+             tasksPerLocale = 0,
+             /* Omit timing output */
+             correctness = false;
+
+proc main() {
+  const nTasks = if tasksPerLocale == 0 then here.maxTaskPar
+                 else tasksPerLocale;
+  const totalOps = opsPerTask * nTasks * numLocales;
+
+  if !correctness {
+    writeln('=====================================');
+    writeln('DistBag Throughput Perf Test');
+    writeln('=====================================');
+    writeln('locales        : ', numLocales);
+    writeln('tasks / locale : ', nTasks);
+    writeln('ops / task     : ', opsPerTask);
+    writeln('bulk size      : ', bulkSize);
+    writeln();
+  }
+
+  var bag = new DistBag(int);
+  var t: Timer;
+
+  // Single-element operations
+  t.start();
+  coforall loc in Locales do on loc {
+    coforall tid in 0..#nTasks {
+      for i in 1..opsPerTask do bag.add(i);
+    }
+  }
+  t.stop();
+  report('add', totalOps, t.elapsed());
+
+  t.clear();
+  var nRemoved: atomic int;
+  t.start();
+  coforall loc in Locales do on loc {
+    coforall tid in 0..#nTasks {
+      var n = 0;
+      for 1..opsPerTask do if bag.remove()(1) then n += 1;
+      nRemoved.add(n);
+    }
+  }
+  t.stop();
+  report('remove', totalOps, t.elapsed());
+  check(nRemoved.read() == totalOps && bag.getSize() == 0, 'single');
+
+  // Bulk operations
+  const nBatches = max(1, opsPerTask / bulkSize);
+  const totalBulkOps = nBatches * bulkSize * nTasks * numLocales;
+
+  t.clear();
+  t.start();
+  coforall loc in Locales do on loc {
+    coforall tid in 0..#nTasks {
+      for 1..nBatches do bag.addBulk(1..bulkSize);
+    }
+  }
+  t.stop();
+  report('bulk add', totalBulkOps, t.elapsed());
+
+  t.clear();
+  nRemoved.write(0);
+  t.start();
+  coforall loc in Locales do on loc {
+    coforall tid in 0..#nTasks {
+      var n = 0;
+      for 1..nBatches do n += bag.removeBulk(bulkSize).size;
+      nRemoved.add(n);
+    }
+  }
+  t.stop();
+  report('bulk remove', totalBulkOps, t.elapsed());
+  check(nRemoved.read() == totalBulkOps && bag.getSize() == 0, 'bulk');
+}
+
+proc report(op, nOps, elapsed) {
+  if !correctness then
+    writeln(op, ' ops/sec: ', nOps / elapsed);
+}
+
+proc check(ok, what) {
+  if !ok then writeln('Error: ', what, ' operations lost elements');
+}
@@ -0,0 +1,94 @@
+use Compression;
+
+config const n = 100000;
+
+const gzPath = "gzip-lines.txt.gz";
+const plainPath = "gzip-lines.txt";
+const copyPath = "gzip-lines-copy.txt.gz";
+
+proc expectedSum() {
+  var sum = 0;
+  for i in 1..n do sum += i;
+  return sum;
+}
+
+// Write lines through a compressing channel.
+{
+  var f = openCompressed(gzPath, iomode.cw);
+  var w = f.writer();
+  for i in 1..n do w.writeln(i);
+  w.close();
+  f.close();
+}
+
+// The compressed file is smaller than the data.
+{
+  var f = openCompressed(gzPath, iomode.r);
+  writeln(open(gzPath, iomode.r).length() < f.length());
+  f.close();
+}
+
+// Read the lines back in order and in parallel.
+proc check(path:string) {
+  var f = openCompressed(path, iomode.r);
+
+  var count = 0, sum = 0;
+  var prev = 0;
+  var inOrder = true;
+  for line in f.lines() {
+    const i = line.strip():int;
+    if i != prev + 1 then inOrder = false;
+    prev = i;
+    count += 1;
+    sum += i;
+  }
+  writeln(inOrder, " ", count == n, " ", sum == expectedSum());
+
+  var parCount = 0, parSum = 0;
+  forall line in f.lines() with (+ reduce parCount, + reduce parSum) {
+    parCount += 1;
+    parSum += line.strip():int;
+  }
+  writeln(parCount == n, " ", parSum == expectedSum());
+
+  // Read starting in the middle of the file.
+  const len = f.length();
+  var r = f.reader(start=len/2);
+  var s:string;
+  r.readline(s);
+  r.readline(s);
+  const i = s.strip():int;
+  writeln(i > 1 && i < n);
+  r.close();
+
+  f.close();
+}
+
+check(gzPath);
+
+// Compress a plain file with several tasks.
+{
+  var f = open(plainPath, iomode.cw);
+  var w = f.writer();
+  for i in 1..n do w.writeln(i);
+  w.close();
+  f.close();
+}
+compressFile(plainPath, copyPath, level=1);
+check(copyPath);
+
+// Invalid modes and levels.
+try {
+  openCompressed(gzPath, iomode.rw);
+} catch e: SystemError {
+  writeln("rw: ", e.err == EINVAL);
+} catch {
+  writeln("rw: unexpected error");
+}
+try {
+  compressFile(plainPath, copyPath, level=10);
+} catch e: SystemError {
+  writeln("level: ", e.err == EINVAL);
+} catch {
+  writeln("level: unexpected error");
+}
@@ -0,0 +1,35 @@
+/*
+  Test that the DistributedIters iterators yield every index once when tasks
+  and locales steal work from each other. Listing the same locale several
+  times in workerLocales gives it one work pool per entry, so stealing
+  between pools is tested even on a single locale.
+*/
+use DistributedIters;
+
+config const n:int = 10007;
+
+const workerLocales = [L in 1..3*numLocales] Locales[L % numLocales];
+
+for (lo, stride) in [(1, 1), (-50, 3)]
+{
+  const r = (lo.. by stride) # n;
+  var counts:[0..#n] atomic int;
+
+  writeln("Testing distributedDynamic over ", r, "...");
+  forall i in distributedDynamic(r, chunkSize=3, localeChunkSize=20,
+                                 workerLocales=workerLocales)
+  do counts[(i - lo) / stride].add(1);
+  check(counts, 1);
+
+  writeln("Testing distributedGuided over ", r, "...");
+  forall i in distributedGuided(r, minChunkSize=2,
+                                workerLocales=workerLocales)
+  do counts[(i - lo) / stride].add(1);
+  check(counts, 2);
+}
+
+proc check(counts, expected:int)
+{
+  const ok = && reduce [c in counts] c.read() == expected;
+  writeln("Result: ", if ok then "pass" else "fail");
+}
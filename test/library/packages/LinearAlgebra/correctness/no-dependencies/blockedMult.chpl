@@ -0,0 +1,66 @@
+use LinearAlgebra, BlockDist;
+
+/* Check the native matrix-matrix and matrix-vector multiplication against
+   a direct computation, for shapes that do not divide evenly into the
+   kernel's blocks and for operands with different index offsets. */
+
+proc refMatMult(A: [?Adom] ?t, B: [?Bdom] t) {
+  var C: [Adom.dim(1), Bdom.dim(2)] t;
+  for (i, j) in C.domain do
+    for (ak, bk) in zip(Adom.dim(2), Bdom.dim(1)) do
+      C[i, j] += A[i, ak] * B[bk, j];
+  return C;
+}
+
+proc fill(ref A: [?D] ?t, seed: int) {
+  for (idx, x) in zip(D, A) {
+    const (i, j) = if D.rank == 1 then (idx, 0) else idx;
+    x = ((i * 7 + j * 13 + seed) % 11 - 5): t;
+  }
+}
+
+proc check(C, R, msg) {
+  if C.shape != R.shape then
+    writeln(msg, ": wrong shape ", C.shape, " != ", R.shape);
+  else if || reduce [(c, r) in zip(C, R)] c != r then
+    writeln(msg, ": wrong result");
+}
+
+proc testShapes(type t, m, k, n, aOff, bOff) {
+  const msg = t:string + " " + (m, k, n):string;
+  var A: [aOff..#m, aOff..#k] t, B: [bOff..#k, bOff+1..#n] t;
+  fill(A, 1);
+  fill(B, 2);
+  check(dot(A, B), refMatMult(A, B), "matmat " + msg);
+
+  var x: [bOff..#k] t, y: [bOff..#m] t;
+  fill(x, 3);
+  fill(y, 4);
+  var X: [x.domain.dim(1), 0..0] t, Y: [0..0, y.domain.dim(1)] t;
+  X[.., 0] = x;
+  Y[0, ..] = y;
+  check(dot(A, x), refMatMult(A, X)[.., 0], "matvec " + msg);
+  check(dot(y, A), refMatMult(Y, A)[0, ..], "vecmat " + msg);
+}
+
+for (m, k, n) in [(1, 1, 1), (3, 5, 2), (4, 4, 4), (65, 257, 259),
+                  (130, 3, 17), (7, 300, 1)] {
+  testShapes(real, m, k, n, 0, 1);
+  testShapes(int, m, k, n, 1, -2);
+}
+testShapes(complex, 33, 40, 50, 0, 0);
+
+// Block distributed operands
+{
+  const m = 70, k = 300, n = 90;
+  const Adom = {1..m, 1..k} dmapped Block({1..m, 1..k}),
+        Bdom = {0..#k, 0..#n} dmapped Block({0..#k, 0..#n});
+  var A: [Adom] real, B: [Bdom] real;
+  fill(A, 5);
+  fill(B, 6);
+  const C = dot(A, B);
+  var LA: [1..m, 1..k] real = A, LB: [0..#k, 0..#n] real = B;
+  check(C, refMatMult(LA, LB), "block matmat");
+}
+
+writeln("done");
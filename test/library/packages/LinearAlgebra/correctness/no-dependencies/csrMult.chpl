@@ -0,0 +1,67 @@
+use LinearAlgebra, LinearAlgebra.Sparse, Random;
+
+/* Check CSR matrix-matrix and matrix-vector multiplication against dense
+   computations, for matrices with a few very long rows.  The wide case
+   makes matrix-matrix multiplication use hash accumulators. */
+
+config const seed = 314159;
+
+proc randomCSR(m, n, density, denseRows) {
+  var D = CSRDomain(1..m, 1..n);
+  var rng = makeRandomStream(real, seed=seed+m*n, parSafe=false);
+  var inds: [1..0] 2*int;
+  for i in 1..m {
+    const p = if i % denseRows == 0 then 0.9 else density;
+    for j in 1..n do
+      if rng.getNext() < p then inds.push_back((i, j));
+  }
+  D += inds;
+  var A: [D] int;
+  forall (i, j) in D do A[i, j] = (i * 3 + j * 5) % 7 - 3;
+  return A;
+}
+
+proc toDense(A) {
+  var M: [A.domain.parentDom] int;
+  for (i, j) in A.domain do M[i, j] = A[i, j];
+  return M;
+}
+
+proc check(m, k, n, density, denseRows = 17) {
+  const A = randomCSR(m, k, density, denseRows),
+        B = randomCSR(k, n, density, denseRows + 6);
+  const DA = toDense(A), DB = toDense(B);
+
+  // Reference product and its structural non-zeros
+  var R: [1..m, 1..n] int, P: [1..m, 1..n] bool;
+  for (i, j) in A.domain do
+    for l in B.domain.dimIter(2, j) {
+      R[i, l] += DA[i, j] * DB[j, l];
+      P[i, l] = true;
+    }
+
+  const C = dot(A, B);
+  var CD: [1..m, 1..n] int, CP: [1..m, 1..n] bool;
+  for (i, j) in C.domain {
+    if CP[i, j] then writeln("duplicate index ", (i, j));
+    CD[i, j] = C[i, j];
+    CP[i, j] = true;
+  }
+  if || reduce (CD != R) then writeln("matmat ", (m, k, n), ": wrong values");
+  if || reduce (CP != P) then writeln("matmat ", (m, k, n), ": wrong indices");
+
+  var x: [1..k] int;
+  forall i in 1..k do x[i] = i % 5 - 2;
+  const y = dot(A, x);
+  for i in 1..m do
+    if y[i] != + reduce (DA[i, ..] * x) then
+      writeln("matvec ", (m, k, n), ": wrong value in row ", i);
+}
+
+check(1, 1, 1, 1.0);
+check(40, 30, 20, 0.1);
+check(60, 50, 4000, 0.02);
+check(60, 50, 20000, 0.002, denseRows=1000);
+check(100, 1, 100, 0.5);
+check(5, 8, 3, 0.0);
+writeln("done");
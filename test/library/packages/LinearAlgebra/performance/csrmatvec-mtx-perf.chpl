@@ -0,0 +1,87 @@
+/*
+  Time CSR matrix-vector and matrix-matrix multiplication for a matrix read
+  from a Matrix Market file, or for a generated matrix with a few very long
+  rows when no file is given.
+*/
+
+use LinearAlgebra;
+use LinearAlgebra.Sparse;
+use MatrixMarket;
+use Random;
+use Time;
+
+config const fname = "",
+             n = 10000,
+             nnzPerRow = 10,
+             /* Every denseRowStride'th generated row has n/10 non-zeros */
+             denseRowStride = 1000,
+             seed = 42,
+             trials = 1,
+             /* Omit non-timing output */
+             performance = false,
+             /* Omit timing output */
+             correctness = false;
+
+proc readCSR(fname) {
+  const S = mmreadsp(real, fname);
+  var D = CSRDomain(S.domain.parentDom);
+  var inds: [1..S.domain.size] 2*int;
+  for (ind, ij) in zip(inds, S.domain) do ind = ij;
+  D += inds;
+  var A: [D] real;
+  for (i, j) in S.domain do A[i, j] = S[i, j];
+  return A;
+}
+
+proc generateCSR() {
+  var D = CSRDomain(1..n, 1..n);
+  var rng = makeRandomStream(int, seed=seed, parSafe=false);
+  var inds: [1..0] 2*int;
+  for i in 1..n {
+    const count = if i % denseRowStride == 0 then n / 10 else nnzPerRow;
+    for 1..count do inds.push_back((i, mod(rng.getNext(), n) + 1));
+  }
+  D += inds;
+  var A: [D] real = 1.0;
+  return A;
+}
+
+proc main() {
+  const A = if fname != "" then readCSR(fname) else generateCSR();
+  const (M, N) = A.shape;
+
+  if !performance {
+    writeln('CSR Matrix');
+    writeln('shape : ', (M, N));
+    writeln('nnz   : ', A.domain.size);
+  }
+
+  var x: [1..N] real = 1.0;
+  var t: Timer;
+
+  var y = dot(A, x);
+  for 1..trials {
+    t.start();
+    y = dot(A, x);
+    t.stop();
+  }
+  if !correctness then
+    writeln('matvec time (s) : ', t.elapsed() / trials);
+  t.clear();
+
+  if !performance then
+    writeln('A * 1 : ', y);
+
+  if M == N {
+    t.start();
+    const AA = dot(A, A);
+    t.stop();
+    if !correctness then
+      writeln('matmat time (s) : ', t.elapsed());
+
+    if !performance {
+      writeln('nnz(A * A)   : ', AA.domain.size);
+      writeln('A * A * 1    : ', dot(AA, x));
+    }
+  }
+}
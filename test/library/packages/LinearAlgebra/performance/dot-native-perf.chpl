@@ -0,0 +1,61 @@
+/*
+  Performance of the native (non-BLAS) matrix-matrix and matrix-vector
+  multiplication used by dot()
+*/
+
+use LinearAlgebra;
+use Time;
+
+config const m = 500,
+             iters = 1,
+             /* Omit timing output */
+             correctness = false;
+
+config type eltType = real;
+
+proc main() {
+  var A = Matrix(m, m, eltType=eltType),
+      B = Matrix(m, m, eltType=eltType);
+  var x = Vector(m, eltType=eltType);
+
+  [(i, j) in A.domain] A[i, j] = ((i + j) % 7): eltType;
+  [(i, j) in B.domain] B[i, j] = ((i * j) % 5): eltType;
+  x = 1: eltType;
+
+  if !correctness {
+    writeln('=====================================');
+    writeln('Native Matrix Multiplication Perf Test');
+    writeln('=====================================');
+    writeln('iters : ', iters);
+    writeln('m     : ', m);
+    writeln();
+  }
+
+  var t: Timer;
+  var C: [A.domain] eltType;
+
+  for 1..iters {
+    t.start();
+    C = dot(A, B);
+    t.stop();
+  }
+  if !correctness then
+    writeln('matrix-matrix: ', t.elapsed() / iters);
+  t.clear();
+
+  var y: [x.domain] eltType, yT: [x.domain] eltType;
+  for 1..iters {
+    t.start();
+    y = dot(A, x);
+    yT = dot(x, A);
+    t.stop();
+  }
+  if !correctness then
+    writeln('matrix-vector: ', t.elapsed() / iters);
+
+  // The entries are small integers, so these are computed exactly
+  const Cx = dot(C, x), ABx = dot(A, dot(B, x));
+  if || reduce (Cx != ABx) then writeln('matrix-matrix: wrong result');
+  if || reduce (yT != dot(transpose(A), x)) then
+    writeln('matrix-vector: wrong result');
+}
@@ -0,0 +1,45 @@
+/*
+ *  Check correctness of binarySearchMany against binarySearch
+ */
+
+use Search;
+use Sort;
+use Random;
+
+config const n = 1000,
+             numVals = 203;
+
+proc main() {
+  const A = [-4, -1, 2, 2, 3];
+  writeln(binarySearchMany(A, [2, -5, 0, 3, 9]));
+
+  var Empty: [1..0] int;
+  writeln(binarySearchMany(Empty, [1, 2]));
+
+  var Data: [0..#n] int;
+  fillRandom(Data, seed=27);
+  for d in Data do d = abs(d) % (n / 2);
+  sort(Data);
+
+  var vals = [i in 0..#numVals] i * n / numVals - 5;
+  checkMany(Data, vals);
+
+  // Strided haystack
+  var Strided: [10..#2*n by 2] int = Data;
+  checkMany(Strided, vals);
+}
+
+// Compare against binarySearch, which may find any of several equal elements
+proc checkMany(Data: [?Dom], vals) {
+  const R = binarySearchMany(Data, vals);
+  const stride = if Dom.stridable then abs(Dom.stride) else 1;
+  var ok = true;
+  for (v, (found, loc)) in zip(vals, R) {
+    const (expFound, expLoc) = binarySearch(Data, v);
+    if found != expFound then ok = false;
+    else if found && (Data[loc] != v || (loc > Dom.low && Data[loc-stride] == v))
+      then ok = false;
+    else if !found && loc != expLoc then ok = false;
+  }
+  writeln(ok);
+}
@@ -0,0 +1,82 @@
+/*
+ *  Check correctness of mergeRuns, stablePartition, unique and
+ *  runLengthEncode against serial results
+ */
+
+use Sort;
+use Random;
+
+config const n = 1000,
+             numRuns = 7;
+
+record KeyCmp {
+  proc key(x) return x(1);
+}
+
+proc main() {
+  // Small examples
+  const A = [1, 4, 6, 9, 2, 3, 4, 4, 0, 7];
+  writeln(mergeRuns(A, [1, 5, 9]));
+
+  var P = [5, 2, 8, 1, 4, 7, 6, 3];
+  const numEven = stablePartition(P, lambda(x: int) { return x % 2 == 0; });
+  writeln(numEven, ": ", P);
+
+  const S = [1, 1, 2, 3, 3, 3, 7, 9, 9];
+  writeln(unique(S));
+  writeln(runLengthEncode(S));
+
+  var Empty: [1..0] int;
+  writeln(mergeRuns(Empty, [1]).size, " ",
+          stablePartition(Empty, lambda(x: int) { return true; }), " ",
+          unique(Empty).size);
+
+  // Random data: runs sorted by key, with the original position as payload
+  var R: [0..#n] int;
+  fillRandom(R, seed=314);
+  var T = [i in 0..#n] (abs(R[i]) % 20, i);
+
+  var starts = [r in 0..#numRuns] r * n / numRuns;
+  for r in 0..#numRuns {
+    const hi = if r == numRuns-1 then n-1 else starts[r+1]-1;
+    sort(T[starts[r]..hi]);
+  }
+
+  // The merge must be sorted by key, keeping positions in order on ties
+  const M = mergeRuns(T, starts, new KeyCmp());
+  var Expected = T;
+  sort(Expected);
+  writeln("mergeRuns: ", && reduce (M == Expected));
+
+  var Part = T;
+  const numSmall = stablePartition(Part, lambda(x: (int, int)) {
+                                           return x(1) < 5;
+                                         });
+  var ExpectedPart: [0..#n] (int, int);
+  var next = 0;
+  for t in T do if t(1) < 5 { ExpectedPart[next] = t; next += 1; }
+  for t in T do if t(1) >= 5 { ExpectedPart[next] = t; next += 1; }
+  writeln("stablePartition: ", numSmall == + reduce [t in T] (t(1) < 5): int,
+          " ", && reduce (Part == ExpectedPart));
+
+  // unique and runLengthEncode compare only keys, so keep the first of each
+  const U = unique(Expected, new KeyCmp());
+  const (V, C) = runLengthEncode(Expected, new KeyCmp());
+  var firsts: [0..#U.size] (int, int),
+      counts: [0..#U.size] int;
+  var run = -1;
+  for (e, i) in zip(Expected, 0..) {
+    if i == 0 || e(1) != Expected[i-1](1) {
+      run += 1;
+      firsts[run] = e;
+    }
+    counts[run] += 1;
+  }
+  writeln("unique: ", U.size == run + 1, " ", && reduce (U == firsts));
+  writeln("runLengthEncode: ", && reduce (V == firsts), " ",
+          && reduce (C == counts));
+
+  // Strided arrays
+  var Strided: [1..2*n by 2] (int, int) = Expected;
+  writeln("strided: ", && reduce (unique(Strided, new KeyCmp()) == U));
+}
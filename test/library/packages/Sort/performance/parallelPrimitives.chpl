@@ -0,0 +1,109 @@
+/*
+    Performance test of the parallel merge, partition, unique and batched
+    search primitives on 2**M bytes of random data
+
+    Note: The correctness test for this is simply checking that it compiles and
+          runs without errors
+ */
+
+use Sort;
+use Search;
+use Random;
+use Time;
+
+config const M: int = 10,                   // 2**M bytes
+             correctness: bool = true,      // Disables output
+             prims: string = 'mpurs',       // Primitives to time (first letter)
+             numRuns: int = 16;             // Runs merged by mergeRuns
+
+// Number of elements
+const N: int = (2**M / numBytes(int)): int;
+
+proc main() {
+  var A: [0..#N] int;
+  fillRandom(A, seed=42);
+
+  var t = new Timer();
+  print('Time taken on ', 2**M, ' bytes (', N, ' ints)');
+
+  if prims.find('m') {
+    var B = A;
+    var starts = [r in 0..#numRuns] r * N / numRuns;
+    for r in 0..#numRuns {
+      const hi = if r == numRuns-1 then N-1 else starts[r+1]-1;
+      sort(B[starts[r]..hi]);
+    }
+    t.start();
+    const C = mergeRuns(B, starts);
+    t.stop();
+    if !isSorted(C) then
+      writeln('mergeRuns failed to merge data');
+    else
+      print('mergeRuns (seconds): ', t.elapsed());
+    t.clear();
+  }
+
+  if prims.find('p') {
+    var B = A;
+    t.start();
+    const numEven = stablePartition(B, lambda(x: int) { return x % 2 == 0; });
+    t.stop();
+    if numEven != + reduce [a in A] (a % 2 == 0): int then
+      writeln('stablePartition failed to partition data');
+    else
+      print('stablePartition (seconds): ', t.elapsed());
+    t.clear();
+  }
+
+  if prims.find('u') > 0 || prims.find('r') > 0 {
+    // Sorted data with runs of repeated values
+    var B = [a in A] abs(a) % (N / 4 + 1);
+    sort(B);
+
+    if prims.find('u') {
+      t.start();
+      const U = unique(B);
+      t.stop();
+      if !isSorted(U) || U.size > N / 4 + 1 then
+        writeln('unique failed to compact data');
+      else
+        print('unique (seconds): ', t.elapsed());
+      t.clear();
+    }
+
+    if prims.find('r') {
+      t.start();
+      const (V, C) = runLengthEncode(B);
+      t.stop();
+      if + reduce C != N then
+        writeln('runLengthEncode failed to encode data');
+      else
+        print('runLengthEncode (seconds): ', t.elapsed());
+      t.clear();
+    }
+  }
+
+  if prims.find('s') {
+    var B = A;
+    sort(B);
+    var needles: [0..#N] int;
+    fillRandom(needles, seed=17);
+    t.start();
+    const R = binarySearchMany(B, needles);
+    t.stop();
+    var ok = true;
+    for i in 0..#N by max(1, N / 1000) do
+      if R[i] != binarySearch(B, needles[i]) then ok = false;
+    if !ok then
+      writeln('binarySearchMany failed to find data');
+    else
+      print('binarySearchMany (seconds): ', t.elapsed());
+    t.clear();
+  }
+}
+
+/* Print if correctness mode is off */
+proc print(args...) {
+  if !correctness then
+    writeln((...args));
+}
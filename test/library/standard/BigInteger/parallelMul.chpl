@@ -0,0 +1,44 @@
+// Check that multiplications split across tasks (see parallelMul.execopts)
+// match the products computed by GMP directly.
+use BigInteger, GMP, Random;
+
+config const numLimbs = 64;
+
+var rs = new RandomStream(uint, seed=314159);
+
+proc randomBigint(limbs: int, negative: bool) {
+  var x = new bigint(0);
+  for 1..limbs {
+    x <<= 64;
+    x += rs.getNext();
+  }
+  if negative then x = -x;
+  return x;
+}
+
+proc expected(const ref a: bigint, const ref b: bigint) {
+  var c = new bigint();
+  mpz_mul(c.mpz, a.mpz, b.mpz);
+  return c;
+}
+
+for (aLimbs, bLimbs) in [(numLimbs, numLimbs), (numLimbs, numLimbs/2 + 1),
+                         (numLimbs * 3, numLimbs), (numLimbs, 1)] {
+  for (aNeg, bNeg) in [(false, false), (true, false), (false, true),
+                       (true, true)] {
+    const a = randomBigint(aLimbs, aNeg);
+    const b = randomBigint(bLimbs, bNeg);
+    const ab = expected(a, b);
+
+    var c = a * b;
+    var d = a;
+    d *= b;
+    var e = new bigint();
+    e.mul(a, b);
+    var f = a;
+    f.mul(f, f);
+
+    writeln(aLimbs, " x ", bLimbs, ": ",
+            c == ab && d == ab && e == ab && f == expected(a, a));
+  }
+}
@@ -0,0 +1,51 @@
+// fillRandom() computes several values at a time; check that it produces
+// the same values as iterate() does one at a time.  Also check the moments
+// of fillRandomNormal().
+use Random, BlockDist;
+
+config const n = 1003;
+
+proc check(type t, param algo, D) {
+  var A, B: [D] t;
+  var rs1 = makeRandomStream(t, seed=12345, parSafe=false, algorithm=algo),
+      rs2 = makeRandomStream(t, seed=12345, parSafe=false, algorithm=algo);
+  rs1.fillRandom(A);
+  for (b, r) in zip(B, rs2.iterate(D, t)) do b = r;
+  if !(&& reduce (A == B)) then
+    writeln("mismatch for ", t:string, " ", algo, " ", D);
+  // both streams should continue from the same place
+  if rs1.getNext() != rs2.getNext() then
+    writeln("stream position mismatch for ", t:string, " ", algo, " ", D);
+}
+
+proc checkAll(D) {
+  check(real, RNG.PCG, D);
+  check(real(32), RNG.PCG, D);
+  check(int, RNG.PCG, D);
+  check(uint(8), RNG.PCG, D);
+  check(bool, RNG.PCG, D);
+  check(complex, RNG.PCG, D);
+  check(imag(32), RNG.PCG, D);
+  check(real, RNG.NPB, D);
+  check(complex, RNG.NPB, D);
+  check(imag, RNG.NPB, D);
+}
+
+checkAll({1..n});
+checkAll({1..5});
+checkAll({0..#37});
+checkAll({1..37, 1..29});
+checkAll({1..200 by 3});
+checkAll({1..n} dmapped Block({1..n}));
+
+proc checkNormal(param algo, mean, stddev) {
+  var A: [1..100000] real;
+  fillRandomNormal(A, mean, stddev, seed=17, algorithm=algo);
+  const m = (+ reduce A) / A.size,
+        sd = sqrt((+ reduce ((A - m)**2)) / A.size);
+  writeln(abs(m - mean) < 0.05 * stddev, " ", abs(sd - stddev) < 0.05 * stddev);
+}
+
+checkNormal(RNG.PCG, 0.0, 1.0);
+checkNormal(RNG.PCG, 3.0, 2.0);
+checkNormal(RNG.NPB, -1.0, 0.5);
@@ -0,0 +1,44 @@
+// Large arrays are shuffled and permuted in parallel.  Check that the
+// results are permutations that only depend on the seed, including for
+// distributed and strided arrays.
+use Random, BlockDist, CyclicDist, Sort;
+
+config const n = 300000;
+
+var A: [1..n] int = 1..n;
+shuffle(A, seed=7);
+var sortedA = A;
+sort(sortedA);
+writeln(&& reduce (sortedA == 1..n));
+writeln(A[1] != 1 || A[n] != n);
+
+const BD = {1..n} dmapped Block({1..n});
+var B: [BD] int = 1..n;
+shuffle(B, seed=7);
+writeln(&& reduce (A == B));
+
+// Cyclic arrays are not stored in contiguous runs, so they are split
+// differently, but the result is the same
+const CD = {1..n} dmapped Cyclic(startIdx=1);
+var Cyc: [CD] int = 1..n;
+shuffle(Cyc, seed=7);
+writeln(&& reduce (A == Cyc));
+
+var P: [BD] int;
+permutation(P, seed=3);
+var sortedP: [1..n] int = P;
+sort(sortedP);
+writeln(&& reduce (sortedP == 1..n));
+
+var C: [0..#2*n by 2] int = 0..#2*n by 2;
+shuffle(C, seed=5);
+var sortedC: [0..#n] int = C;
+sort(sortedC);
+writeln(&& reduce (sortedC == (0..#2*n by 2)));
+
+// The stream is advanced past the values the shuffle used
+var rs1 = makeRandomStream(int, seed=11, parSafe=false),
+    rs2 = makeRandomStream(int, seed=11, parSafe=false);
+rs1.shuffle(A);
+rs2.skipToNth(2*n+1);
+writeln(rs1.getNext() == rs2.getNext());
@@ -0,0 +1,28 @@
+use BlockDist;
+
+config const n = 20;
+
+const D = {1..n} dmapped Block({1..n});
+const E = {1..n} dmapped Block({1..n});
+
+var A, B, C: [D] int;
+var X: [E] int;
+
+// aligned: all accesses can be local
+forall i in D do B[i] = i;
+forall i in D do C[i] = 2*i;
+forall i in D do A[i] = B[i] + C[i];
+writeln(A);
+
+// X is declared over a different domain: falls back at run time
+forall i in A.domain do X[i] = A[i] + B[i];
+writeln(X);
+
+// non-distributed iterand: falls back at compile time
+proc inc(M: [] int, Dom) {
+  forall i in Dom do M[i] += 1;
+}
+
+inc(A, D);
+inc(A, {1..n});
+writeln(A);
@@ -0,0 +1,31 @@
+use BlockDist;
+
+config const n = 20;
+
+const D = {1..n} dmapped Block({1..n});
+
+var A, B, C: [D] int;
+
+forall i in D do A[i] = i;
+
+// A[i] in the nested forall may be read on any locale, so only the
+// accesses outside of it can be local
+forall i in D {
+  var sum = 0;
+  forall j in D with (+ reduce sum) do sum += A[i] * (j % 2);
+  B[i] = sum;
+}
+writeln(B);
+
+forall i in D {
+  coforall t in 1..2 with (ref C) do
+    if t == 1 then C[i] = A[i] + 1;
+}
+writeln(C);
+
+// the nested forall writes the same elements from other locales
+forall i in D {
+  forall j in D do
+    if j == i then C[i] = -A[i];
+}
+writeln(C);
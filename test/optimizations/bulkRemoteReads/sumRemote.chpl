@@ -0,0 +1,73 @@
+use CommDiagnostics;
+
+config const n = 100000;
+
+var A: [1..n] int;
+
+for i in 1..n do A[i] = i;
+
+//
+// Serial loops that only read consecutive elements of a remote array
+// should read them in bulk rather than one GET per element.
+//
+proc sumOnRemote(lo: int, hi: int) {
+  var sum = 0;
+  on Locales[numLocales-1] {
+    var s = 0;
+    for i in lo..hi do s += A[i];
+    sum = s;
+  }
+  return sum;
+}
+
+proc oddsOnRemote() {
+  var count = 0;
+  on Locales[numLocales-1] {
+    var c = 0;
+    for i in 1..n {
+      const a = A[i];
+      if a % 2 == 1 then c += 1;
+    }
+    count = c;
+  }
+  return count;
+}
+
+resetCommDiagnostics();
+startCommDiagnostics();
+const sum = sumOnRemote(1, n);
+stopCommDiagnostics();
+
+writeln(sum == n*(n+1)/2);
+writeln(getCommDiagnostics()[numLocales-1].get < n/100);
+
+writeln(sumOnRemote(n/2, n/2 + 3) == 4*(n/2) + 6);
+writeln(sumOnRemote(10, 1) == 0);
+writeln(oddsOnRemote() == (n+1)/2);
+
+// Reads under a conditional are left alone: here the condition keeps the
+// index in bounds, so reading ahead to A[n+1000] would run off the end.
+proc guardedSumOnRemote() {
+  var sum = 0;
+  on Locales[numLocales-1] {
+    var s = 0;
+    for i in 1..n+1000 do
+      if i <= n then s += A[i];
+    sum = s;
+  }
+  return sum;
+}
+
+resetCommDiagnostics();
+startCommDiagnostics();
+const guardedSum = guardedSumOnRemote();
+stopCommDiagnostics();
+
+writeln(guardedSum == n*(n+1)/2);
+writeln(getCommDiagnostics()[numLocales-1].get >= n);
+
+// Loops that also write remote memory are left alone.
+on Locales[numLocales-1] {
+  for i in 2..n do A[i] = A[i-1] + A[i];
+}
+writeln(A[n] == n*(n+1)/2);
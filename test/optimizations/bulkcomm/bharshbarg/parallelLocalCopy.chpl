@@ -0,0 +1,57 @@
+//
+// Local array assignment splits large copies across tasks (see
+// dataParMinTransferBytes in DefaultRectangular).  The .execopts lower the
+// threshold so that even these small arrays are split, into a number of
+// pieces that does not divide most of the lengths evenly.
+//
+const lengths = [1, 2, 3, 5, 7, 64, 100, 1001, 4099];
+
+var ok = true;
+
+proc check(A, B, what) {
+  if ! && reduce (A == B) {
+    writeln("mismatch: ", what);
+    ok = false;
+  }
+}
+
+proc testElt(type t) {
+  for n in lengths {
+    // contiguous: whole arrays and an inner slice
+    var A, B: [1..n] t;
+    forall i in 1..n do B[i] = i: t;
+    A = B;
+    check(A, B, "flat " + n:string);
+
+    var C: [1..n] t;
+    C[2..n-1] = B[2..n-1];
+    check(C[2..n-1], B[2..n-1], "flat slice " + n:string);
+    if n > 1 && (C[1] != 0: t || C[n] != 0: t) {
+      writeln("overwrote outside slice: ", n);
+      ok = false;
+    }
+
+    // strided: all but the first column of a 2D array, and a 3D block
+    const D2 = {1..n, 1..5};
+    var A2, B2: [D2] t;
+    forall (i, j) in D2 do B2[i, j] = (i*5 + j): t;
+    A2[.., 2..] = B2[.., 2..];
+    check(A2[.., 2..], B2[.., 2..], "strided 2D " + n:string);
+    if ! && reduce (A2[.., 1] == 0: t) {
+      writeln("overwrote first column: ", n);
+      ok = false;
+    }
+
+    const D3 = {1..n, 1..3, 1..4};
+    var A3, B3: [D3] t;
+    forall (i, j, k) in D3 do B3[i, j, k] = (i*12 + j*4 + k): t;
+    A3[.., 2..3, 1..3] = B3[.., 2..3, 1..3];
+    check(A3[.., 2..3, 1..3], B3[.., 2..3, 1..3], "strided 3D " + n:string);
+  }
+}
+
+testElt(int);
+testElt(int(8));
+testElt(real(32));
+
+writeln(if ok then "SUCCESS" else "FAILURE");
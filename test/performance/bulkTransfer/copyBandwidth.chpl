@@ -0,0 +1,67 @@
+//
+// Measures the bandwidth of local array assignment as the array size
+// grows.  Large copies are split across tasks (see dataParMinTransferBytes
+// in DefaultRectangular), so the bandwidth should keep rising past the
+// point where a single memmove() saturates one core.
+//
+use Time;
+
+config const minBytes = 1024,
+             maxBytes = 1024 * 1024 * 1024,
+             numTrials = 5;
+
+config const printTimings = false;
+
+proc main() {
+  var ok = true;
+  var bytes = minBytes;
+
+  while bytes <= maxBytes {
+    const n = bytes / numBytes(int);
+
+    //
+    // contiguous: a single memmove() per task
+    //
+    var A, B: [1..n] int;
+    forall i in 1..n do B[i] = i;
+
+    var flatTime = timeCopy(A, B);
+    ok &&= && reduce (A == B);
+
+    //
+    // strided: every row but the first column of a 2D array
+    //
+    const cols = 64;
+    const D = {1..n/cols, 1..cols};
+    var A2, B2: [D] int;
+    forall (i, j) in D do B2[i, j] = i*cols + j;
+
+    var strdTime = timeCopy(A2[.., 2..], B2[.., 2..]);
+    ok &&= && reduce (A2[.., 2..] == B2[.., 2..]);
+    ok &&= && reduce (A2[.., 1] == 0);
+
+    if printTimings {
+      writeln("flat ", bytes, " bytes (GB/s): ", bytes / flatTime / 1e9);
+      writeln("strided ", bytes, " bytes (GB/s): ", bytes / strdTime / 1e9);
+    }
+
+    bytes *= 4;
+  }
+
+  writeln("Validation: ", if ok then "SUCCESS" else "FAILURE");
+}
+
+proc timeCopy(ref A, B) {
+  var t: Timer;
+  var best = max(real);
+
+  for trial in 1..numTrials {
+    t.clear();
+    t.start();
+    A = B;
+    t.stop();
+    best = min(best, t.elapsed());
+  }
+
+  return best;
+}
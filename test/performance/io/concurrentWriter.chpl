@@ -0,0 +1,94 @@
+//
+// Measures the throughput (MB/s) of many tasks writing small records to
+// one file, comparing a single shared channel with locking=true against
+// a ConcurrentWriter, where each task collects records in its own
+// TaskWriter and only reserves a region of the file per batch.
+//
+// Each record is 100 bytes: the task number and record number followed
+// by filler and a newline.
+//
+use IO, Time;
+
+config const numTasks = 64,
+             recordsPerTask = 100000,
+             numTrials = 3;
+
+config const printTimings = false;
+
+config const filename = "concurrentWriter.txt";
+
+const recordBytes = 100;
+
+proc main() {
+  var ok = true;
+
+  for (name, concurrent) in [("locking channel", false),
+                             ("concurrent writer", true)] {
+    var best = max(real);
+
+    for trial in 1..numTrials {
+      var t: Timer;
+      t.start();
+      writeFile(concurrent);
+      t.stop();
+      best = min(best, t.elapsed());
+
+      ok &&= checkFile();
+    }
+
+    if printTimings then
+      writeln(name, " MB/s: ",
+              numTasks * recordsPerTask * recordBytes / best / 1e6);
+  }
+
+  unlink(filename);
+
+  writeln("Validation: ", if ok then "SUCCESS" else "FAILURE");
+}
+
+// Return record 'r' of task 'tid' as a 100-byte string.
+proc makeRecord(tid: int, r: int) {
+  const prefix = "%04i,%010i,".format(tid, r);
+  return prefix + "x" * (recordBytes - 1 - prefix.length) + "\n";
+}
+
+proc writeFile(concurrent: bool) {
+  var f = open(filename, iomode.cw);
+
+  if concurrent {
+    var cw = f.concurrentWriter();
+    coforall tid in 0..#numTasks {
+      var w = cw.taskWriter();
+      for r in 0..#recordsPerTask do
+        w.write(makeRecord(tid, r));
+    }
+  } else {
+    var ch = f.writer();
+    coforall tid in 0..#numTasks {
+      for r in 0..#recordsPerTask do
+        ch.write(makeRecord(tid, r));
+    }
+    ch.close();
+  }
+
+  f.close();
+}
+
+// Check that every record was written exactly once and intact.
+proc checkFile() {
+  var f = open(filename, iomode.r);
+  var count:[0..#numTasks] int;
+  var ok = f.length() == numTasks * recordsPerTask * recordBytes;
+
+  for line in f.lines() {
+    const tid = line[1..4]:int;
+    const r = line[6..15]:int;
+    if line.length != recordBytes || line != makeRecord(tid, r) then
+      ok = false;
+    else
+      count[tid] += 1;
+  }
+  f.close();
+
+  return ok && && reduce (count == recordsPerTask);
+}
@@ -0,0 +1,97 @@
+//
+// Measures the throughput (MB/s) of searching a file channel with a
+// regular expression.  Unanchored searches run RE2 directly over the
+// data buffered in the channel (see bulk_search in re2-interface.cc),
+// so a scan with a pattern that has a maximum match length should run at
+// close to the speed of an in-memory search.  Patterns without one, like
+// [0-9]+, are searched by MatchFile unless the window reaches the end of
+// the data, since a match could run past the end of the window.
+//
+// The file consists of lines of filler text.  Every 'gap' bytes a
+// numeric token replaces part of a line; tokens are placed so that some
+// of them straddle the boundaries of the search windows.
+//
+use IO, Time, Regexp;
+
+config const fileBytes = 64 * 1024 * 1024,
+             gap = 100003,
+             numTrials = 3;
+
+config const printTimings = false;
+
+config const filename = "channelSearch.txt";
+
+const token = "12345678";
+
+proc main() {
+  const numTokens = writeFile();
+  var ok = true;
+
+  for pattern in ["[0-9]{8}", "[0-9]+", "(\\d)\\d{7}"] {
+    var best = max(real);
+
+    for trial in 1..numTrials {
+      var t: Timer;
+      t.start();
+      const (count, sum) = searchFile(pattern);
+      t.stop();
+      best = min(best, t.elapsed());
+
+      ok &&= count == numTokens && sum == numTokens * token.length;
+    }
+
+    if printTimings then
+      writeln(pattern, ": ", fileBytes / best / 1e6, " MB/s");
+  }
+
+  unlink(filename);
+
+  writeln("Validation: ", if ok then "SUCCESS" else "FAILURE");
+}
+
+// Write the file and return the number of tokens in it.
+proc writeFile() {
+  const line = "the quick brown fox jumps over the lazy dog\n";
+  var f = open(filename, iomode.cw);
+  var w = f.writer(locking=false);
+  var pos = 0, nextToken = gap, numTokens = 0;
+
+  while pos < fileBytes {
+    if pos + line.length > nextToken && nextToken + token.length <= fileBytes {
+      const before = nextToken - pos;
+      w.write(line[1..before], token);
+      pos += before + token.length;
+      nextToken += gap;
+      numTokens += 1;
+    } else {
+      const n = min(line.length, fileBytes - pos);
+      w.write(line[1..n]);
+      pos += n;
+    }
+  }
+
+  w.close();
+  f.close();
+  return numTokens;
+}
+
+// Search for every match of 'pattern' and return the number of matches
+// and their total length.
+proc searchFile(pattern: string) {
+  var f = open(filename, iomode.r);
+  var r = f.reader(locking=false);
+  var re = compile(pattern);
+  var count, sum = 0;
+
+  while true {
+    var m = r.search(re);
+    if !m.matched then break;
+    count += 1;
+    sum += m.length;
+    r.advance(m.length);
+  }
+
+  r.close();
+  f.close();
+  return (count, sum);
+}
@@ -0,0 +1,64 @@
+//
+// Measures the bandwidth of simple vectorizable forall kernels over
+// local DefaultRectangular arrays.  daxpyLLVM runs the same program
+// with the LLVM backend so the two backends' loop vectorization can be
+// compared.
+//
+use Time;
+
+config const n = 1000000,
+             numTrials = 10,
+             alpha = 3.0;
+
+config const printTimings = false;
+
+proc main() {
+  var X, Y, Z: [1..n] real;
+
+  forall i in 1..n {
+    X[i] = i;
+    Y[i] = 2.0;
+  }
+
+  var t: Timer;
+
+  //
+  // daxpy: Y = alpha*X + Y
+  //
+  var daxpyTime = max(real);
+  for trial in 1..numTrials {
+    t.clear();
+    t.start();
+    forall (x, y) in zip(X, Y) do
+      y = alpha*x + y;
+    t.stop();
+    daxpyTime = min(daxpyTime, t.elapsed());
+  }
+
+  //
+  // STREAM triad: Z = X + alpha*Y
+  //
+  var triadTime = max(real);
+  for trial in 1..numTrials {
+    t.clear();
+    t.start();
+    forall (z, x, y) in zip(Z, X, Y) do
+      z = x + alpha*y;
+    t.stop();
+    triadTime = min(triadTime, t.elapsed());
+  }
+
+  const expectY = [i in 1..n] 2.0 + numTrials*alpha*i,
+        expectZ = [i in 1..n] i + alpha*expectY[i];
+
+  if && reduce (Y == expectY) && && reduce (Z == expectZ) then
+    writeln("Validation: SUCCESS");
+  else
+    writeln("Validation: FAILURE");
+
+  if printTimings {
+    const bytes = numBytes(real) * n;
+    writeln("daxpy (GB/s) = ", 3 * bytes / daxpyTime * 1e-9);
+    writeln("triad (GB/s) = ", 3 * bytes / triadTime * 1e-9);
+  }
+}
@@ -0,0 +1 @@
+daxpy.chpl
\ No newline at end of file
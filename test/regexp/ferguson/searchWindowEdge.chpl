@@ -0,0 +1,32 @@
+//
+// Channel searches run RE2 over the buffered data one window at a time
+// (see bulk_search in re2-interface.cc).  Check that a match starting
+// before the end of a window but ending after it is still the one
+// found, even when a later match lies entirely within the window.
+//
+// The window ends where the buffered data does, so try the match
+// straddling several power-of-two offsets.
+//
+use IO, Regexp;
+
+for edge in [4096, 64*1024, 1024*1024] {
+  const matchStart = edge - 10;
+  var f = openmem();
+  {
+    var w = f.writer();
+    w.write("x" * matchStart, "a", "b" * 20, "c", "\n");
+    w.close();
+  }
+
+  // unbounded, and bounded but longer than the bytes left in the window
+  for pattern in ["ab*c|b", "ab{0,30}c|b"] {
+    var r = f.reader();
+    var re = compile(pattern);
+    var m = r.search(re);
+    writeln(edge, " ", pattern, ": ", m.matched, " ", m.offset - matchStart,
+            " ", m.length);
+    r.close();
+  }
+
+  f.close();
+}
@@ -0,0 +1,100 @@
+use LayoutCS, Random;
+
+config const n = 50;
+config const numInds = 400;
+config const seed = 17;
+
+const D2 = {0..#n, 0..#n};
+
+// Add random batches of indices (with duplicates and indices already in the
+// domain) in bulk and one at a time, and check that the domains and the
+// values of arrays over them agree.
+proc check2D(ref bulkDom, ref refDom, param name) {
+  var bulkArr: [bulkDom] int;
+  var refArr: [refDom] int;
+
+  var rs = makeRandomStream(int, seed, parSafe=false);
+  for round in 1..3 {
+    var inds: [0..#numInds] 2*int;
+    for i in inds do
+      i = (mod(rs.getNext(), n), mod(rs.getNext(), n));
+
+    const added = bulkDom.bulkAdd(inds);
+    var refAdded = 0;
+    for i in inds do refAdded += refDom.add(i);
+
+    if added != refAdded then
+      writeln(name, ": bulkAdd returned ", added, ", expected ", refAdded);
+    if bulkDom.size != refDom.size then
+      writeln(name, ": size mismatch");
+    for (b, r) in zip(bulkDom, refDom) do
+      if b != r then writeln(name, ": index mismatch ", b, " ", r);
+    for (b, r) in zip(bulkArr, refArr) do
+      if b != r then writeln(name, ": value mismatch");
+
+    forall i in refDom with (ref bulkArr, ref refArr) {
+      bulkArr[i] = i[1]*n + i[2];
+      refArr[i] = i[1]*n + i[2];
+    }
+  }
+  writeln(name, ": ", bulkDom.size);
+}
+
+proc check1D(ref bulkDom, ref refDom, param name) {
+  var bulkArr: [bulkDom] int;
+  var rs = makeRandomStream(int, seed, parSafe=false);
+  for round in 1..3 {
+    var inds: [0..#numInds] int;
+    for i in inds do i = mod(rs.getNext(), n*n);
+
+    const added = bulkDom.bulkAdd(inds);
+    var refAdded = 0;
+    for i in inds do refAdded += refDom.add(i);
+
+    if added != refAdded then
+      writeln(name, ": bulkAdd returned ", added, ", expected ", refAdded);
+    for (b, r) in zip(bulkDom, refDom) do
+      if b != r then writeln(name, ": index mismatch ", b, " ", r);
+    for i in bulkDom do
+      if bulkArr[i] != 0 && bulkArr[i] != i then
+        writeln(name, ": value mismatch at ", i);
+
+    forall i in bulkDom with (ref bulkArr) do bulkArr[i] = i;
+  }
+  writeln(name, ": ", bulkDom.size);
+}
+
+{
+  var bulkDom, refDom: sparse subdomain(D2);
+  check2D(bulkDom, refDom, "default");
+}
+{
+  var bulkDom, refDom: sparse subdomain(D2) dmapped CS();
+  check2D(bulkDom, refDom, "CSR");
+}
+{
+  var bulkDom, refDom: sparse subdomain(D2) dmapped CS(compressRows=false);
+  check2D(bulkDom, refDom, "CSC");
+}
+{
+  var bulkDom, refDom: sparse subdomain({0..#n*n});
+  check1D(bulkDom, refDom, "default 1D");
+}
+
+// Associative domains: indices already present are not added again, and
+// existing array values are kept.
+{
+  var A: domain(int);
+  var X: [A] int;
+  A += 5;
+  X[5] = 55;
+
+  var inds: [0..#numInds] int;
+  for (x, i) in zip(inds, 0..) do x = i % (numInds/2);
+  const added = A.bulkAdd(inds);
+
+  var ok = added == numInds/2 - 1 && A.size == numInds/2 && X[5] == 55;
+  for i in 0..#numInds/2 do
+    if !A.contains(i) || (i != 5 && X[i] != 0) then ok = false;
+  writeln("associative: ", ok);
+}
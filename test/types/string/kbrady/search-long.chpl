@@ -0,0 +1,54 @@
+// Checks searches over long strings, which use the runtime's search
+// routines, against the same searches over a strided region, which use
+// the byte-at-a-time loop.
+
+config const numTrials = 300;
+
+var seed = 12345;
+proc next(n: int) {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return (seed / 65536) % n;
+}
+
+proc randomString(len: int, alphabet: int) {
+  var s: string;
+  for 1..len do
+    s += (97 + next(alphabet)):uint(8):string;
+  return s;
+}
+
+var ok = true;
+for trial in 1..numTrials {
+  const alphabet = 1 + next(4);
+  const hay = randomString(next(2000), alphabet);
+  const nLen = min(1 + next(40), hay.length);
+  const needle = if nLen > 0 && next(2) == 0
+    then hay[1 + next(hay.length - nLen + 1)..#nLen]
+    else randomString(1 + next(40), alphabet);
+  const needle2 = needle[1..min(needle.length, 1 + next(3))];
+  const lo = 1 + next(max(1, hay.length / 4));
+  const region = lo..hay.length;
+
+  for n in (needle, needle2) {
+    if hay.find(n, region) != hay.find(n, region by 1) ||
+       hay.rfind(n, region) != hay.rfind(n, region by 1) ||
+       hay.count(n, region) != hay.count(n, region by 1) {
+      writeln("mismatch searching for ", n, " in ", hay, " over ", region);
+      ok = false;
+    }
+  }
+}
+writeln(ok);
+
+// Overlapping matches are each counted
+const a = "a" * 1000;
+writeln(a.count("aa"), " ", a.count("a" * 300), " ", a.rfind("aaa"));
+
+// Searches within a region of a long string
+const b = "x" * 500 + "needle" + "x" * 500 + "needle" + "x" * 500;
+writeln(b.find("needle"), " ", b.rfind("needle"), " ", b.count("needle"));
+writeln(b.find("needle", 502..), " ", b.rfind("needle", ..1010));
+writeln(b.find("needle", 502..1010), " ", b.count("xneedlex", 400..1100));
+var parts = 0;
+for s in b.split("needle") do parts += 1;
+writeln(b.replace("needle", "N").length, " ", parts);
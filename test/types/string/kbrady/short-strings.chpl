@@ -0,0 +1,48 @@
+// Exercise strings that move between the inline (short) and heap
+// representations.
+
+var s: string;
+for i in 1..20 {
+  s += (i % 10):string;
+  writeln(s.length, " ", s);
+}
+
+// slices that are short and long
+const long = "abcdefghijklmnopqrstuvwxyz";
+writeln(long[1..3], " ", long[1..15], " ", long[1..16], " ", long[2..26]);
+writeln(long[1..26 by 2], " ", long[1..10 by -3]);
+
+// copies and assignment keep independent bytes
+var a = "short";
+var b = a;
+b += "er";
+writeln(a, " ", b);
+a = long;
+b = a;
+a += "!";
+writeln(a, " ", b);
+a = "tiny";
+writeln(a, " ", b);
+
+// building strings through other operations
+writeln("-".join("a", "b", "c"), " ", "-".join(long, long));
+writeln("ab" * 7, " ", "ab" * 8);
+writeln("MiXeD".toLower(), " ", "MiXeD".toUpper(), " ", (long * 2).toUpper());
+writeln("hello world".toTitle(), " ", "word".capitalize());
+writeln(12345:string + 6.5:string, " ", "15 characters!!".length);
+
+// c_str of a short string
+var cs = "abc".c_str();
+writeln(cs:string);
+
+// short strings as keys and in sorted order
+var D: domain(string);
+for w in "the quick brown fox jumps over the lazy dog".split() do
+  D += w;
+writeln(D.size, " ", D.contains("fox"), " ", D.contains("cat"));
+for w in D.sorted() do
+  write(w, " ");
+writeln();
+
+// comparisons across representations
+writeln("abc" < "abd", " ", long < long + "a", " ", long[1..15] == "abcdefghijklmno");
@@ -0,0 +1,66 @@
+use Time;
+use Sort;
+
+config const timing = true;
+config const n = 1000000;
+config const sourcePath = "moby.txt";
+
+var mobyFile = open(sourcePath, iomode.r);
+var mobyReader = mobyFile.reader();
+
+var Passage: [1..n] string;
+var word: string;
+var i = 1;
+while i <= n {
+  if mobyReader.read(word) {
+    Passage[i] = word;
+    i += 1;
+  } else {
+    mobyReader = mobyFile.reader();
+  }
+}
+
+// split: join the words into lines of ten and split them again
+var Lines: [1..n/10] string;
+for i in Lines.domain do
+  Lines[i] = " ".join(Passage[(i-1)*10+1..i*10]);
+
+var tSplit: Timer;
+var numWords = 0;
+if timing then tSplit.start();
+for line in Lines do
+  for w in line.split() do
+    numWords += 1;
+if timing then tSplit.stop();
+
+// associative: build a domain of the distinct words, then look them up
+var tAssocAdd: Timer;
+var Words: domain(string);
+if timing then tAssocAdd.start();
+for w in Passage do
+  Words += w;
+if timing then tAssocAdd.stop();
+
+var tAssocLookup: Timer;
+var numFound = 0;
+if timing then tAssocLookup.start();
+for w in Passage do
+  if Words.contains(w) then numFound += 1;
+if timing then tAssocLookup.stop();
+
+// sort: sort a copy of the words
+var Sorted = Passage;
+var tSort: Timer;
+if timing then tSort.start();
+sort(Sorted);
+if timing then tSort.stop();
+
+if timing {
+  writeln("split: ", tSplit.elapsed());
+  writeln("assoc add: ", tAssocAdd.elapsed());
+  writeln("assoc lookup: ", tAssocLookup.elapsed());
+  writeln("sort: ", tSort.elapsed());
+}
+
+if numWords == (n/10)*10 && numFound == n && isSorted(Sorted) then
+  writeln("SUCCESS");
@@ -230,6 +230,14 @@ void RE2::Init(const StringPiece& pattern, const Options& options) {
   is_one_pass_ = prog_->IsOnePass();
 }
 
+bool RE2::anchored_start() const {
+  if (prog_ == NULL)
+    return false;
+  // A required prefix is only computed for a regexp beginning with ^,
+  // and is stripped from prog_ along with the ^.
+  return prog_->anchor_start() || !prefix_.empty();
+}
+
 // Returns rprog_, computing it if needed.
 re2::Prog* RE2::ReverseProg() const {
   std::call_once(rprog_once_, [](const RE2* re) {
@@ -808,12 +816,21 @@ bool RE2::MatchFile(FilePiece& text,
     if( found ) {
       // If we found a match and that's all we wanted to know...
       if( nsubmatch == 0 ) return true;
-      // Otherwise, we could be doing a greedy search
-      // that could continue past the end of that buffer.
-      // So advance to that position and then continue.
-      skip = vec[0].begin() - buffer.begin();
-      // we have some kind of match here!
-      re_anchor = ANCHOR_START;
+      // A match starting before this one could run past the end of
+      // the buffer, where the in-memory search cannot see it.  That is
+      // only ruled out if the buffer holds the rest of the text or the
+      // maximum match length keeps such a match within the buffer.
+      int64_t found_at = vec[0].begin() - buffer.begin();
+      if( (int64_t) buffer.size() >= text.size() ||
+          (max_match_length_ >= 0 &&
+           found_at + max_match_length_ < (int64_t) buffer.size()) ) {
+        // Otherwise, we could be doing a greedy search
+        // that could continue past the end of that buffer.
+        // So advance to that position and then continue.
+        skip = found_at;
+        // we have some kind of match here!
+        re_anchor = ANCHOR_START;
+      }
     } else {
       // There was no match.
       // Given the minimum and maximum match lengths...
@@ -295,6 +295,8 @@ class RE2 {
   int min_match_length_bytes() const { return min_match_length_; }
   // Return the maximum number of matched bytes or -1 for unbounded
   int max_match_length_bytes() const { return max_match_length_; }
+  // Return true if the regexp can only match at the start of the text
+  bool anchored_start() const;
 
   /***** The array-based matching interface ******/
 